@@ -0,0 +1,184 @@
+/********************************************************************************/
+/*!
+	@file			display_asset.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Zero-Copy Asset Pack Reader.								@n
+					Pack is addressed in place(XIP flash,mmap),no staging RAM.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added RLE565 format.
+		2026.10.19	V3.00	Indexed expansion by IdxFB kernels.
+		2026.10.19	V4.00	Emit by shared DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_asset.h"
+/* check header file version for fool proof */
+#if DISPLAY_ASSET_H != 0x0400
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t dapk_line[DAPK_LINE_PIXELS*2];
+static uint16_t dapk_rgb[256];
+static IdxFB_Lut_t dapk_lut;
+static const uint8_t* dapk_lut_pal;			/* palette dapk_lut was built from */
+static uint8_t dapk_lut_bpp;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Open Pack at base address.
+	Returns 0 on success,-1 on bad header.
+*/
+/**************************************************************************/
+int DispAsset_open(DispAsset_t* pk, const void* base)
+{
+	const DispAsset_Header_t* h = (const DispAsset_Header_t*)base;
+
+	if ((h->magic != DAPK_MAGIC) || (h->version != DAPK_VERSION)) return -1;
+
+	pk->base  = (const uint8_t*)base;
+	pk->index = (const DispAsset_Entry_t*)(pk->base + sizeof(DispAsset_Header_t));
+	pk->count = h->count;
+	dapk_lut_pal = NULL;						/* pack may be reloaded at same address */
+
+	return 0;
+}
+
+/**************************************************************************/
+/*!
+    Name Hash(FNV-1a),same as packer.
+*/
+/**************************************************************************/
+uint32_t DispAsset_hash(const char* name)
+{
+	uint32_t h = 2166136261u;
+
+	while (*name) {
+		h ^= (uint8_t)*name++;
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+/**************************************************************************/
+/*!
+    Find Entry by Name,NULL if not found.
+	Hash only,dapk refuses packs with two names of the same hash.
+*/
+/**************************************************************************/
+const DispAsset_Entry_t* DispAsset_lookup(const DispAsset_t* pk, const char* name)
+{
+	uint32_t h = DispAsset_hash(name);
+	uint16_t i;
+
+	for (i = 0; i < pk->count; i++) {
+		if (pk->index[i].hash == h) return &pk->index[i];
+	}
+
+	return NULL;
+}
+
+/**************************************************************************/
+/*!
+    Get Payload Pointer(in place).
+*/
+/**************************************************************************/
+const uint8_t* DispAsset_data(const DispAsset_t* pk, const DispAsset_Entry_t* e)
+{
+	return pk->base + e->offset;
+}
+
+/**************************************************************************/
+/*!
+    Build Expansion Tables from Pack Palette(MSB first),kept per palette.
+*/
+/**************************************************************************/
+static void DispAsset_lut(const uint8_t* pal, uint8_t bpp)
+{
+	uint16_t i,n = (bpp == 8) ? 256 : 16;
+
+	if ((pal == dapk_lut_pal) && (bpp == dapk_lut_bpp)) return;
+
+	for (i = 0; i < n; i++) dapk_rgb[i] = (uint16_t)(pal[i*2] << 8 | pal[i*2 + 1]);
+	dapk_lut.out = IDXFB_OUT_RGB565;
+	IdxFB_lut_build(&dapk_lut, dapk_rgb, 0, n, bpp);
+	dapk_lut_pal = pal;
+	dapk_lut_bpp = bpp;
+}
+
+/**************************************************************************/
+/*!
+    Blit Image Asset at (x,y).
+	RGB565 is fed to wr_block straight from the pack(DMA from flash).
+	Indexed data is expanded per line by IdxFB kernels through the palette.
+	RLE data is decoded into fills and in-place literals.
+	Returns 0 on success,-1 on unsupported format.
+*/
+/**************************************************************************/
+int DispAsset_blit(const DispAsset_t* pk, const DispAsset_Entry_t* e, uint16_t x, uint16_t y, const DispOps_t* ops)
+{
+	const uint8_t* p = DispAsset_data(pk, e);
+	uint32_t j,k,done,fill,stride;
+	uint8_t  bpp;
+
+	if (!e->width || !e->height) return -1;
+
+	switch (e->format) {
+	case DAPK_FMT_RGB565:
+		ops->rect(x, x + e->width - 1, y, y + e->height - 1);
+		DispOps_emit(ops, p, (uint32_t)e->width * e->height * 2);
+		return 0;
+
+	case DAPK_FMT_INDEX8:
+	case DAPK_FMT_INDEX4:
+		bpp	   = (e->format == DAPK_FMT_INDEX8) ? 8 : 4;
+		stride = (bpp == 8) ? e->width : (e->width + 1u) / 2;
+		DispAsset_lut(p, bpp);
+		p += (bpp == 8) ? 256*2 : 16*2;
+		ops->rect(x, x + e->width - 1, y, y + e->height - 1);
+
+		fill = 0;
+		for (j = 0; j < e->height; j++, p += stride) {
+			for (done = 0; done < e->width; done += k) {
+				k = DAPK_LINE_PIXELS - fill / 2;
+				if (k > e->width - done) k = e->width - done;
+
+				if (bpp == 8)	fill += IdxFB_expand8(&dapk_lut, dapk_line + fill, p + done, k);
+				else			fill += IdxFB_expand4(&dapk_lut, dapk_line + fill, p, done, k);
+
+				if (fill == sizeof(dapk_line)) {
+					ops->wr_block(dapk_line, fill);
+					fill = 0;
+				}
+			}
+		}
+		DispOps_emit(ops, dapk_line, fill);
+		return 0;
+
+	case DAPK_FMT_RLE565:
+		return DispRLE_blit(x, x + e->width - 1, y, y + e->height - 1, p, e->size, ops);
+
+	default:
+		return -1;
+	}
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,89 @@
+/********************************************************************************/
+/*!
+	@file			display_asset.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Zero-Copy Asset Pack Reader.								@n
+					Pack is addressed in place(XIP flash,mmap),no staging RAM.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added RLE565 format.
+		2026.10.19	V3.00	Indexed expansion by IdxFB kernels.
+		2026.10.19	V4.00	Emit by shared DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_ASSET_H
+#define DISPLAY_ASSET_H 0x0400
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+#include "display_rle.h"
+#include "display_indexfb.h"
+
+/* Pack Layout(little endian,made by tools/dapk.c)
+   [Header 16bytes][Index count*20bytes][pad][Payload aligned DAPK_ALIGN]... */
+#define DAPK_MAGIC			0x4B504144	/* "DAPK" */
+#define DAPK_VERSION		1
+#define DAPK_ALIGN			32			/* payload alignment,DMA burst/cache line */
+
+/* Payload Formats */
+#define DAPK_FMT_RAW		0			/* opaque data(fonts etc.) */
+#define DAPK_FMT_RGB565		1			/* bus byte order(MSB first),wr_block as is */
+#define DAPK_FMT_INDEX8		2			/* 256*RGB565 palette(MSB first) + 8bpp */
+#define DAPK_FMT_INDEX4		3			/* 16*RGB565 palette(MSB first) + 4bpp,high nibble left */
+#define DAPK_FMT_RLE565		4			/* run-length RGB565,see display_rle.h */
+
+/* Indexed line expansion(pixels) */
+#ifndef DAPK_LINE_PIXELS
+ #define DAPK_LINE_PIXELS	320
+#endif
+
+typedef struct {
+	uint32_t	magic;
+	uint16_t	version;
+	uint16_t	count;
+	uint32_t	size;				/* whole pack bytes */
+	uint32_t	reserved;
+} DispAsset_Header_t;
+
+typedef struct {
+	uint32_t	hash;				/* FNV-1a of name */
+	uint32_t	offset;				/* from pack top,DAPK_ALIGN aligned */
+	uint32_t	size;
+	uint16_t	width;
+	uint16_t	height;
+	uint8_t		format;
+	uint8_t		reserved[3];
+} DispAsset_Entry_t;
+
+typedef struct {
+	const uint8_t*					base;
+	const DispAsset_Entry_t*		index;
+	uint16_t						count;
+} DispAsset_t;
+
+/* Asset Pack Functions Prototype */
+extern int DispAsset_open(DispAsset_t* pk, const void* base);
+extern uint32_t DispAsset_hash(const char* name);
+extern const DispAsset_Entry_t* DispAsset_lookup(const DispAsset_t* pk, const char* name);
+extern const uint8_t* DispAsset_data(const DispAsset_t* pk, const DispAsset_Entry_t* e);
+extern int DispAsset_blit(const DispAsset_t* pk, const DispAsset_Entry_t* e, uint16_t x, uint16_t y, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_ASSET_H */
@@ -0,0 +1,320 @@
+/********************************************************************************/
+/*!
+	@file			display_comp.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Multi-Layer Alpha Compositor on Line Bands.				@n
+					RGB565,ARGB4444,A8 mask and solid layers to wr_block.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added host SIMD(SSE2/NEON) blend.
+		2026.10.19	V3.00	Added per-layer time(DCOMP_LAYER_TIME).
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_comp.h"
+/* check header file version for fool proof */
+#if DISPLAY_COMP_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+#if defined(DCOMP_USE_SIMD) && defined(__SSE2__)
+ #include <emmintrin.h>
+#elif defined(DCOMP_USE_SIMD)
+ #include <arm_neon.h>
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+/* 5bit alpha 0..32 */
+#define DCOMP_A5(a)			(((uint32_t)(a) + 4) >> 3)
+
+/* Variables -----------------------------------------------------------------*/
+static DispOps_t dcomp_ops;
+static uint16_t  dcomp_line[DCOMP_BAND_LINES][DCOMP_MAX_WIDTH];
+static uint8_t   dcomp_out[DCOMP_BAND_LINES * DCOMP_MAX_WIDTH * 2];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize Compositor.
+*/
+/**************************************************************************/
+void DispComp_init(const DispOps_t* ops)
+{
+	dcomp_ops = *ops;
+}
+
+/**************************************************************************/
+/*!
+    Blend Two Pixels per 32bit Word with Uniform Alpha(0..32).
+	Each channel is isolated in 16bit lanes so products never carry.
+*/
+/**************************************************************************/
+static inline uint32_t DispComp_pair(uint32_t s, uint32_t d, uint32_t a5)
+{
+	uint32_t ia = 32 - a5;
+	uint32_t b  = ((( s        & 0x001F001F) * a5 + ( d        & 0x001F001F) * ia + 0x00100010) >> 5) & 0x001F001F;
+	uint32_t g  = ((((s >>  5) & 0x003F003F) * a5 + ((d >>  5) & 0x003F003F) * ia + 0x00100010) >> 5) & 0x003F003F;
+	uint32_t r  = ((((s >> 11) & 0x001F001F) * a5 + ((d >> 11) & 0x001F001F) * ia + 0x00100010) >> 5) & 0x001F001F;
+
+	return (r << 11) | (g << 5) | b;
+}
+
+/* One pixel with its own alpha(0..32),G spread to upper half */
+static inline uint16_t DispComp_one(uint32_t s, uint32_t d, uint32_t a5)
+{
+	s = (s | (s << 16)) & 0x07E0F81F;
+	d = (d | (d << 16)) & 0x07E0F81F;
+	d = ((s * a5 + d * (32 - a5) + 0x02008010) >> 5) & 0x07E0F81F;
+
+	return (uint16_t)(d | (d >> 16));
+}
+
+#ifdef DCOMP_USE_SIMD
+/* Eight pixels in 16bit lanes,same rounding as DispComp_pair */
+static inline void DispComp_blend8(uint16_t* dst, const uint16_t* src, uint32_t a5)
+{
+#if defined(__SSE2__)
+	__m128i s  = _mm_loadu_si128((const __m128i*)src);
+	__m128i d  = _mm_loadu_si128((const __m128i*)dst);
+	__m128i a  = _mm_set1_epi16((short)a5);
+	__m128i ia = _mm_set1_epi16((short)(32 - a5));
+	__m128i rn = _mm_set1_epi16(16);
+	__m128i m5 = _mm_set1_epi16(0x1F);
+	__m128i m6 = _mm_set1_epi16(0x3F);
+	__m128i b,g,r;
+
+	b = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(s, m5), a), _mm_mullo_epi16(_mm_and_si128(d, m5), ia));
+	g = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(s, 5), m6), a),
+					  _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(d, 5), m6), ia));
+	r = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(s, 11), a), _mm_mullo_epi16(_mm_srli_epi16(d, 11), ia));
+	b = _mm_srli_epi16(_mm_add_epi16(b, rn), 5);
+	g = _mm_srli_epi16(_mm_add_epi16(g, rn), 5);
+	r = _mm_srli_epi16(_mm_add_epi16(r, rn), 5);
+	_mm_storeu_si128((__m128i*)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b));
+#else
+	uint16x8_t s  = vld1q_u16(src);
+	uint16x8_t d  = vld1q_u16(dst);
+	uint16x8_t a  = vdupq_n_u16((uint16_t)a5);
+	uint16x8_t ia = vdupq_n_u16((uint16_t)(32 - a5));
+	uint16x8_t rn = vdupq_n_u16(16);
+	uint16x8_t m5 = vdupq_n_u16(0x1F);
+	uint16x8_t m6 = vdupq_n_u16(0x3F);
+	uint16x8_t b,g,r;
+
+	b = vmlaq_u16(vmulq_u16(vandq_u16(s, m5), a), vandq_u16(d, m5), ia);
+	g = vmlaq_u16(vmulq_u16(vandq_u16(vshrq_n_u16(s, 5), m6), a), vandq_u16(vshrq_n_u16(d, 5), m6), ia);
+	r = vmlaq_u16(vmulq_u16(vshrq_n_u16(s, 11), a), vshrq_n_u16(d, 11), ia);
+	b = vshrq_n_u16(vaddq_u16(b, rn), 5);
+	g = vshrq_n_u16(vaddq_u16(g, rn), 5);
+	r = vshrq_n_u16(vaddq_u16(r, rn), 5);
+	vst1q_u16(dst, vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b));
+#endif
+}
+#endif
+
+void DispComp_blend_pair(uint16_t* dst, const uint16_t* src, uint32_t n, uint32_t a5)
+{
+	uint32_t s,d;
+
+#ifdef DCOMP_USE_SIMD
+	for (; n >= 8; n -= 8, src += 8, dst += 8) DispComp_blend8(dst, src, a5);
+#endif
+	/* align dst to 32bit */
+	if (((uintptr_t)dst & 2) && n) {
+		*dst = DispComp_one(*src++, *dst, a5); dst++;
+		n--;
+	}
+	for (; n >= 2; n -= 2, src += 2, dst += 2) {
+		memcpy(&s, src, 4);
+		d = *(uint32_t*)dst;
+		*(uint32_t*)dst = DispComp_pair(s, d, a5);
+	}
+	if (n) *dst = DispComp_one(*src, *dst, a5);
+}
+
+void DispComp_blend_solid(uint16_t* dst, uint16_t colour, uint32_t n, uint32_t a5)
+{
+	uint32_t s = (uint32_t)colour | ((uint32_t)colour << 16);
+
+#ifdef DCOMP_USE_SIMD
+	uint16_t c8[8] = { colour, colour, colour, colour, colour, colour, colour, colour };
+
+	for (; n >= 8; n -= 8, dst += 8) DispComp_blend8(dst, c8, a5);
+#endif
+	if (((uintptr_t)dst & 2) && n) {
+		*dst = DispComp_one(colour, *dst, a5); dst++;
+		n--;
+	}
+	for (; n >= 2; n -= 2, dst += 2) {
+		*(uint32_t*)dst = DispComp_pair(s, *(uint32_t*)dst, a5);
+	}
+	if (n) *dst = DispComp_one(colour, *dst, a5);
+}
+
+/**************************************************************************/
+/*!
+    Line to Bus Byte Order(MSB first).
+*/
+/**************************************************************************/
+static inline uint8_t* DispComp_put(uint8_t* o, const uint16_t* s, uint32_t n)
+{
+#if defined(DCOMP_USE_SIMD) && defined(__SSE2__)
+	__m128i v;
+
+	for (; n >= 8; n -= 8, s += 8, o += 16) {
+		v = _mm_loadu_si128((const __m128i*)s);
+		_mm_storeu_si128((__m128i*)o, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+	}
+#elif defined(DCOMP_USE_SIMD)
+	for (; n >= 8; n -= 8, s += 8, o += 16) vst1q_u8(o, vrev16q_u8(vreinterpretq_u8_u16(vld1q_u16(s))));
+#endif
+	for (; n; n--, s++) {
+		*o++ = (uint8_t)(*s >> 8);
+		*o++ = (uint8_t)*s;
+	}
+
+	return o;
+}
+
+/**************************************************************************/
+/*!
+    Check Layer is Opaque over the Row Segment.
+*/
+/**************************************************************************/
+static inline int DispComp_covers(const DispComp_Layer_t* l, int32_t x0, int32_t x1, int32_t y)
+{
+	return (l->alpha == 255) && ((l->type == DCOMP_RGB565) || (l->type == DCOMP_SOLID)) &&
+		   (l->x <= x0) && (l->x + l->w - 1 >= x1) && (l->y <= y) && (l->y + l->h - 1 >= y);
+}
+
+/**************************************************************************/
+/*!
+    Composite One Row Segment.
+*/
+/**************************************************************************/
+static void DispComp_row(uint16_t* dst, DispComp_Layer_t* layer, uint8_t n, int32_t x0, int32_t x1, int32_t y)
+{
+	DispComp_Layer_t* l;
+	int32_t  lx0,lx1,i,k;
+	uint32_t w = (uint32_t)(x1 - x0 + 1);
+	uint32_t a5,a;
+	int      start = -1;
+	uint16_t c;
+#ifdef DCOMP_LAYER_TIME
+	uint32_t t0;
+#endif
+
+	/* topmost opaque layer covering whole segment,below are skipped */
+	for (i = n - 1; i >= 0; i--) {
+		if (DispComp_covers(&layer[i], x0, x1, y)) { start = i; break; }
+	}
+	for (i = 0; i < start; i++) layer[i].skipped += w;
+	if (start < 0) {
+		memset(dst, 0, w * 2);
+		start = 0;
+	}
+
+	for (k = start; k < n; k++) {
+		l = &layer[k];
+		if (!l->alpha || (y < l->y) || (y >= l->y + l->h)) continue;
+		lx0 = (l->x > x0) ? l->x : x0;
+		lx1 = (l->x + l->w - 1 < x1) ? l->x + l->w - 1 : x1;
+		if (lx0 > lx1) continue;
+
+		w = (uint32_t)(lx1 - lx0 + 1);
+		l->pixels += w;
+		a5 = DCOMP_A5(l->alpha);
+#ifdef DCOMP_LAYER_TIME
+		t0 = DispComp_clock();
+#endif
+
+		switch (l->type) {
+		case DCOMP_RGB565:
+			{
+				const uint16_t* s = (const uint16_t*)l->data + (uint32_t)(y - l->y) * l->stride + (lx0 - l->x);
+				if (l->alpha == 255)	memcpy(&dst[lx0 - x0], s, w * 2);
+				else					DispComp_blend_pair(&dst[lx0 - x0], s, w, a5);
+			}
+			break;
+
+		case DCOMP_SOLID:
+			if (l->alpha == 255)	{ for (i = lx0; i <= lx1; i++) dst[i - x0] = l->colour; }
+			else					DispComp_blend_solid(&dst[lx0 - x0], l->colour, w, a5);
+			break;
+
+		case DCOMP_ARGB4444:
+			{
+				const uint16_t* s = (const uint16_t*)l->data + (uint32_t)(y - l->y) * l->stride + (lx0 - l->x);
+				for (i = lx0; i <= lx1; i++, s++) {
+					a = (uint32_t)(*s >> 12) * 17 * l->alpha / 255;
+					if (!a) continue;
+					c = (uint16_t)((((*s >> 8) & 0x0F) << 12 | ((*s >> 8) & 0x08) << 8) |
+								   (((*s >> 4) & 0x0F) << 7  | ((*s >> 4) & 0x0C) << 3) |
+								   (((*s     ) & 0x0F) << 1  | ((*s     ) & 0x08) >> 3));
+					dst[i - x0] = (a == 255) ? c : DispComp_one(c, dst[i - x0], DCOMP_A5(a));
+				}
+			}
+			break;
+
+		case DCOMP_A8:
+			{
+				const uint8_t* s = (const uint8_t*)l->data + (uint32_t)(y - l->y) * l->stride + (lx0 - l->x);
+				for (i = lx0; i <= lx1; i++, s++) {
+					a = (uint32_t)*s * l->alpha / 255;
+					if (!a) continue;
+					dst[i - x0] = (a == 255) ? l->colour : DispComp_one(l->colour, dst[i - x0], DCOMP_A5(a));
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+#ifdef DCOMP_LAYER_TIME
+		l->ticks += DispComp_clock() - t0;
+#endif
+	}
+}
+
+/**************************************************************************/
+/*!
+    Composite Region and Send to the Panel.
+	Region is one window,each band of DCOMP_BAND_LINES goes to wr_block.
+*/
+/**************************************************************************/
+void DispComp_flush(DispComp_Layer_t* layer, uint8_t n, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint32_t w,j,cnt,y;
+	uint8_t* o;
+
+	if (x1 - x0 + 1 > DCOMP_MAX_WIDTH) x1 = (uint16_t)(x0 + DCOMP_MAX_WIDTH - 1);
+	w = (uint32_t)(x1 - x0 + 1);
+
+	dcomp_ops.rect(x0, x1, y0, y1);
+
+	for (y = y0; y <= y1; y += DCOMP_BAND_LINES) {
+		cnt = (y1 - y + 1 < DCOMP_BAND_LINES) ? y1 - y + 1 : DCOMP_BAND_LINES;
+
+		o = dcomp_out;
+		for (j = 0; j < cnt; j++) {
+			DispComp_row(dcomp_line[j], layer, n, x0, x1, (int32_t)(y + j));
+			o = DispComp_put(o, dcomp_line[j], w);
+		}
+
+		DispOps_emit(&dcomp_ops, dcomp_out, (uint32_t)(o - dcomp_out));
+	}
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,83 @@
+/********************************************************************************/
+/*!
+	@file			display_comp.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Multi-Layer Alpha Compositor on Line Bands.				@n
+					RGB565,ARGB4444,A8 mask and solid layers to wr_block.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added host SIMD(SSE2/NEON) blend.
+		2026.10.19	V3.00	Added per-layer time(DCOMP_LAYER_TIME).
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_COMP_H
+#define DISPLAY_COMP_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Band Buffer */
+#ifndef DCOMP_MAX_WIDTH
+ #define DCOMP_MAX_WIDTH	320			/* MUST be even */
+#endif
+#ifndef DCOMP_BAND_LINES
+ #define DCOMP_BAND_LINES	4
+#endif
+
+/* Per-layer blend time in layer ticks,define DCOMP_LAYER_TIME in MAKEFILE
+   and give DispComp_clock()(free running counter,e.g. DWT CYCCNT) */
+#ifdef DCOMP_LAYER_TIME
+ extern uint32_t DispComp_clock(void);
+#endif
+
+/* Host SIMD(SSE2/NEON) for blend and output,plain C on Cortex-M */
+#if !defined(DCOMP_NO_SIMD) && (defined(__SSE2__) || defined(__ARM_NEON))
+ #define DCOMP_USE_SIMD
+#endif
+
+/* Layer Types */
+#define DCOMP_RGB565		0			/* native uint16_t pixels */
+#define DCOMP_ARGB4444		1			/* native uint16_t,A in bit15-12 */
+#define DCOMP_A8			2			/* uint8_t coverage,drawn in colour */
+#define DCOMP_SOLID			3			/* colour only */
+
+/* Layer,index 0 is bottom */
+typedef struct {
+	uint8_t			type;
+	uint8_t			alpha;			/* global alpha 0..255 */
+	uint16_t		colour;			/* A8/SOLID */
+	int16_t			x, y;
+	uint16_t		w, h;
+	const void*		data;
+	uint16_t		stride;			/* pixels per line */
+	/* statistics */
+	uint32_t		pixels;			/* blended */
+	uint32_t		skipped;		/* pixels skipped as covered */
+	uint32_t		ticks;			/* own blend time(DCOMP_LAYER_TIME) */
+} DispComp_Layer_t;
+
+/* Compositor Functions Prototype */
+extern void DispComp_init(const DispOps_t* ops);
+extern void DispComp_flush(DispComp_Layer_t* layer, uint8_t n, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+extern void DispComp_blend_pair(uint16_t* dst, const uint16_t* src, uint32_t n, uint32_t a5);
+extern void DispComp_blend_solid(uint16_t* dst, uint16_t colour, uint32_t n, uint32_t a5);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_COMP_H */
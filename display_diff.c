@@ -0,0 +1,312 @@
+/********************************************************************************/
+/*!
+	@file			display_diff.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Row/Tile Hash Frame Differencing for RAM Framebuffers.	@n
+					Only changed spans of a full frame go to the panel.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Four lane hash with host SIMD(SSE2/NEON).
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_diff.h"
+/* check header file version for fool proof */
+#if DISPLAY_DIFF_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+#if defined(DDIFF_USE_SIMD) && defined(__SSE2__)
+ #include <emmintrin.h>
+#elif defined(DDIFF_USE_SIMD)
+ #include <arm_neon.h>
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DDIFF_FNV_BASIS		2166136261u
+#define DDIFF_FNV_PRIME		16777619u
+/* Dirty span in tiles */
+typedef struct {
+	uint8_t		t0, t1;
+	uint8_t		used;
+} DispDiff_Span_t;
+
+/* Open rectangle in tiles/lines */
+typedef struct {
+	uint8_t		t0, t1;
+	uint16_t	y0, h;
+} DispDiff_Open_t;
+
+/* Variables -----------------------------------------------------------------*/
+DispDiff_Stat_t DispDiff_Stat;
+static uint32_t ddiff_hash[DDIFF_MAX_HEIGHT][DDIFF_MAX_TILES];	/* last flushed frame */
+static DispDiff_Open_t ddiff_open[DDIFF_MAX_OPEN];
+static uint32_t ddiff_nopen;
+static uint16_t ddiff_width, ddiff_height, ddiff_tiles;
+static uint32_t ddiff_stride;
+static uint32_t ddiff_cost = DDIFF_RECT_COST;
+static uint8_t  ddiff_valid;
+static const DispOps_t* ddiff_ops;
+static const uint8_t*   ddiff_frame;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Set Frame Geometry and Output,stride is pixels per line in memory.
+	First flush after this sends whole frame.
+	Returns 0 on success,-1 if frame exceeds the limits.
+*/
+/**************************************************************************/
+int DispDiff_init(uint16_t width, uint16_t height, uint32_t stride, const DispOps_t* ops)
+{
+	if (!width || (width > DDIFF_MAX_WIDTH) || (width & 1) ||
+		!height || (height > DDIFF_MAX_HEIGHT) || (stride < width)) return -1;
+
+	ddiff_width  = width;
+	ddiff_height = height;
+	ddiff_stride = stride;
+	ddiff_tiles  = (uint16_t)((width + DDIFF_TILE_W - 1) / DDIFF_TILE_W);
+	ddiff_ops	 = ops;
+	ddiff_valid  = 0;
+	memset(&DispDiff_Stat, 0, sizeof(DispDiff_Stat));
+
+	return 0;
+}
+
+/**************************************************************************/
+/*!
+    Set Window Cost in Pixels for the Driver/Bus in use.
+	e.g. 4-wire SPI rect sends 11 bytes + 3 DC turns,i8080 is cheaper.
+*/
+/**************************************************************************/
+void DispDiff_set_cost(uint32_t rect_pixels)
+{
+	ddiff_cost = rect_pixels;
+}
+
+/**************************************************************************/
+/*!
+    Forget Last Frame(e.g. after panel was drawn by others).
+*/
+/**************************************************************************/
+void DispDiff_invalidate(void)
+{
+	ddiff_valid = 0;
+}
+
+#if defined(DDIFF_USE_SIMD) && defined(__SSE2__)
+/* 32bit lane multiply,SSE2 has only even lanes */
+static inline __m128i DispDiff_mul32(__m128i a, __m128i b)
+{
+	__m128i e = _mm_mul_epu32(a, b);
+	__m128i o = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(e, _MM_SHUFFLE(0,0,2,0)), _mm_shuffle_epi32(o, _MM_SHUFFLE(0,0,2,0)));
+}
+#endif
+
+/**************************************************************************/
+/*!
+    Word-Wide Hash,two pixels per step.
+	Four FNV-1a lanes(word i goes to lane i%4) folded at end,lanes run
+	in parallel on dual-issue cores and in one SIMD register on host.
+*/
+/**************************************************************************/
+uint32_t DispDiff_hash(const uint32_t* p, uint32_t nwords)
+{
+	uint32_t l[4] = { DDIFF_FNV_BASIS, DDIFF_FNV_BASIS, DDIFF_FNV_BASIS, DDIFF_FNV_BASIS };
+	uint32_t h,i;
+
+#if defined(DDIFF_USE_SIMD) && defined(__SSE2__)
+	{
+		__m128i v = _mm_set1_epi32((int)DDIFF_FNV_BASIS);
+		__m128i m = _mm_set1_epi32((int)DDIFF_FNV_PRIME);
+
+		for (; nwords >= 4; nwords -= 4, p += 4) {
+			v = DispDiff_mul32(_mm_xor_si128(v, _mm_loadu_si128((const __m128i*)p)), m);
+		}
+		_mm_storeu_si128((__m128i*)l, v);
+	}
+#elif defined(DDIFF_USE_SIMD)
+	{
+		uint32x4_t v = vdupq_n_u32(DDIFF_FNV_BASIS);
+
+		for (; nwords >= 4; nwords -= 4, p += 4) {
+			v = vmulq_n_u32(veorq_u32(v, vld1q_u32(p)), DDIFF_FNV_PRIME);
+		}
+		vst1q_u32(l, v);
+	}
+#else
+	for (; nwords >= 4; nwords -= 4, p += 4) {
+		l[0] = (l[0] ^ p[0]) * DDIFF_FNV_PRIME;
+		l[1] = (l[1] ^ p[1]) * DDIFF_FNV_PRIME;
+		l[2] = (l[2] ^ p[2]) * DDIFF_FNV_PRIME;
+		l[3] = (l[3] ^ p[3]) * DDIFF_FNV_PRIME;
+	}
+#endif
+	for (i = 0; i < nwords; i++) l[i] = (l[i] ^ p[i]) * DDIFF_FNV_PRIME;
+
+	h = l[0];
+	for (i = 1; i < 4; i++) h = (h ^ l[i]) * DDIFF_FNV_PRIME;
+
+	return h;
+}
+
+/**************************************************************************/
+/*!
+    Send Rectangle from Frame.
+*/
+/**************************************************************************/
+static void DispDiff_emit(const DispDiff_Open_t* r)
+{
+	uint32_t x0 = (uint32_t)r->t0 * DDIFF_TILE_W;
+	uint32_t x1 = (uint32_t)(r->t1 + 1) * DDIFF_TILE_W;
+	const uint8_t* p;
+	uint32_t w,j;
+
+	if (x1 > ddiff_width) x1 = ddiff_width;
+	w = x1 - x0;
+	p = ddiff_frame + ((uint32_t)r->y0 * ddiff_stride + x0) * 2;
+
+	ddiff_ops->rect(x0, x1 - 1, r->y0, r->y0 + r->h - 1);
+	if (w == ddiff_stride) {
+		/* whole lines are contiguous */
+		ddiff_ops->wr_block((uint8_t*)p, w * r->h * 2);
+	}
+	else {
+		for (j = 0; j < r->h; j++, p += ddiff_stride * 2) ddiff_ops->wr_block((uint8_t*)p, w * 2);
+	}
+
+	DispDiff_Stat.windows++;
+	DispDiff_Stat.pixels += w * r->h;
+}
+
+/**************************************************************************/
+/*!
+    Line Dirty Mask to Spans,gaps cheaper than a window are bridged.
+*/
+/**************************************************************************/
+static uint32_t DispDiff_spans(uint32_t mask, DispDiff_Span_t* s)
+{
+	uint32_t n = 0,t = 0,e;
+
+	while (mask >> t) {
+		while (!(mask & (1u << t))) t++;
+		for (e = t; (e + 1 < 32) && (mask & (1u << (e + 1))); e++);
+
+		if (n && ((t - s[n-1].t1 - 1) * DDIFF_TILE_W < ddiff_cost)) {
+			s[n-1].t1 = (uint8_t)e;
+		}
+		else {
+			s[n].t0	  = (uint8_t)t;
+			s[n].t1	  = (uint8_t)e;
+			s[n].used = 0;
+			n++;
+		}
+		if (e == 31) break;
+		t = e + 1;
+	}
+
+	return n;
+}
+
+/**************************************************************************/
+/*!
+    Close Open Rectangle i.
+*/
+/**************************************************************************/
+static void DispDiff_close(uint32_t i)
+{
+	DispDiff_emit(&ddiff_open[i]);
+	ddiff_open[i] = ddiff_open[--ddiff_nopen];
+}
+
+/**************************************************************************/
+/*!
+    Flush Frame,only tiles whose hash changed since last flush are sent.
+	Spans of a line extend an open rectangle above when the overdraw
+	costs less than a new window.
+	Returns number of windows sent.
+*/
+/**************************************************************************/
+uint32_t DispDiff_flush(const uint8_t* frame)
+{
+	DispDiff_Span_t span[DDIFF_MAX_TILES];
+	uint32_t windows = DispDiff_Stat.windows;
+	uint32_t y,t,i,k,n,mask,h,u0,u1,waste;
+	const uint8_t* row;
+	DispDiff_Open_t* r;
+
+	ddiff_frame = frame;
+	ddiff_nopen = 0;
+
+	for (y = 0; y < ddiff_height; y++) {
+		row  = frame + y * ddiff_stride * 2;
+		mask = 0;
+		for (t = 0; t < ddiff_tiles; t++) {
+			n = ddiff_width - t * DDIFF_TILE_W;
+			if (n > DDIFF_TILE_W) n = DDIFF_TILE_W;
+			h = DispDiff_hash((const uint32_t*)(row + t * DDIFF_TILE_W * 2), n / 2);
+			if (!ddiff_valid || (h != ddiff_hash[y][t])) {
+				ddiff_hash[y][t] = h;
+				mask |= 1u << t;
+			}
+		}
+		n = DispDiff_spans(mask, span);
+
+		/* extend or close rectangles open on the line above */
+		for (i = 0; i < ddiff_nopen; ) {
+			r = &ddiff_open[i];
+			for (k = 0; k < n; k++) {
+				if (!span[k].used && (span[k].t0 <= r->t1) && (span[k].t1 >= r->t0)) break;
+			}
+			if (k < n) {
+				u0 = (span[k].t0 < r->t0) ? span[k].t0 : r->t0;
+				u1 = (span[k].t1 > r->t1) ? span[k].t1 : r->t1;
+				/* unchanged pixels sent by growing both to the union */
+				waste = ((u1 - u0) - (span[k].t1 - span[k].t0) + ((u1 - u0) - (r->t1 - r->t0)) * r->h) * DDIFF_TILE_W;
+				if (waste < ddiff_cost) {
+					r->t0 = (uint8_t)u0;
+					r->t1 = (uint8_t)u1;
+					r->h++;
+					span[k].used = 1;
+					i++;
+					continue;
+				}
+			}
+			DispDiff_close(i);
+		}
+
+		/* new rectangles */
+		for (k = 0; k < n; k++) {
+			if (span[k].used) continue;
+			if (ddiff_nopen == DDIFF_MAX_OPEN) DispDiff_close(0);
+			r = &ddiff_open[ddiff_nopen++];
+			r->t0 = span[k].t0;
+			r->t1 = span[k].t1;
+			r->y0 = (uint16_t)y;
+			r->h  = 1;
+		}
+	}
+	while (ddiff_nopen) DispDiff_close(0);
+
+	ddiff_valid = 1;
+	DispDiff_Stat.frames++;
+	DispDiff_Stat.full_pixels += (uint32_t)ddiff_width * ddiff_height;
+
+	return DispDiff_Stat.windows - windows;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,85 @@
+/********************************************************************************/
+/*!
+	@file			display_diff.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Row/Tile Hash Frame Differencing for RAM Framebuffers.	@n
+					Only changed spans of a full frame go to the panel.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Four lane hash with host SIMD(SSE2/NEON).
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_DIFF_H
+#define DISPLAY_DIFF_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Frame Size Limits,hash table is MAX_HEIGHT*(MAX_WIDTH/TILE_W) words */
+#ifndef DDIFF_MAX_WIDTH
+ #define DDIFF_MAX_WIDTH	320
+#endif
+#ifndef DDIFF_MAX_HEIGHT
+ #define DDIFF_MAX_HEIGHT	320
+#endif
+/* Tile width(pixels),MUST be even */
+#ifndef DDIFF_TILE_W
+ #define DDIFF_TILE_W		32
+#endif
+#define DDIFF_MAX_TILES		((DDIFF_MAX_WIDTH + DDIFF_TILE_W - 1) / DDIFF_TILE_W)
+#if (DDIFF_MAX_TILES > 32) || (DDIFF_TILE_W & 1)
+ #error "DDIFF_TILE_W MUST be even and give 32 tiles per line or less!"
+#endif
+
+/* Window set cost in pixels sent(rect command/address bytes and CS turns).
+   Gaps and overdraw cheaper than this are sent rather than split. */
+#ifndef DDIFF_RECT_COST
+ #define DDIFF_RECT_COST	24
+#endif
+/* Rectangles open at once while scanning down */
+#ifndef DDIFF_MAX_OPEN
+ #define DDIFF_MAX_OPEN		8
+#endif
+
+/* Host SIMD(SSE2/NEON) for tile hash,plain C on Cortex-M(same hash value) */
+#if !defined(DDIFF_NO_SIMD) && (defined(__SSE2__) || defined(__ARM_NEON))
+ #define DDIFF_USE_SIMD
+#endif
+
+/* Statistics */
+typedef struct {
+	uint32_t	frames;
+	uint32_t	windows;
+	uint32_t	pixels;				/* pixels sent */
+	uint32_t	full_pixels;		/* pixels a full flush would send */
+} DispDiff_Stat_t;
+
+extern DispDiff_Stat_t DispDiff_Stat;
+
+/* Frame Differencing Functions Prototype */
+/* frame is RGB565 bus byte order(same as wr_block),4byte aligned,width MUST be even */
+extern int DispDiff_init(uint16_t width, uint16_t height, uint32_t stride, const DispOps_t* ops);
+extern void DispDiff_set_cost(uint32_t rect_pixels);
+extern void DispDiff_invalidate(void);
+extern uint32_t DispDiff_hash(const uint32_t* p, uint32_t nwords);
+extern uint32_t DispDiff_flush(const uint8_t* frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_DIFF_H */
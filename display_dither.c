@@ -0,0 +1,369 @@
+/********************************************************************************/
+/*!
+	@file			display_dither.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Line Based Dithering Stage for 24bit Sources.			@n
+					Ordered(4x4 Bayer) and Floyd-Steinberg to RGB565/444/666.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Sent RGB444/666 through PixFmt_begin().
+		2026.10.19	V3.00	Added host SIMD(SSE2/NEON) ordered RGB565.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_dither.h"
+/* check header file version for fool proof */
+#if DISPLAY_DITHER_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+#if defined(DDITHER_USE_SIMD) && defined(__SSE2__)
+ #include <emmintrin.h>
+#elif defined(DDITHER_USE_SIMD)
+ #include <arm_neon.h>
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DDITHER_CLAMP(v)	(((v) < 0) ? 0 : ((v) > 255) ? 255 : (v))
+/* Nearest level as (v*M+K)>>S in 16bit,equals ddither_q for 5/6bit */
+#define DDITHER_Q5_M		249
+#define DDITHER_Q5_K		1020
+#define DDITHER_Q5_S		11
+#define DDITHER_Q6_M		253
+#define DDITHER_Q6_K		510
+#define DDITHER_Q6_S		10
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  ddither_q[3][256];				/* 8bit -> level */
+static int8_t   ddither_e[3][256];				/* 8bit - level reconstructed */
+static int8_t   ddither_ofs[3][16];				/* Bayer offset per cell */
+static int16_t  ddither_err[3][DDITHER_MAX_WIDTH + 1];	/* next line error*16,[x+1] */
+static int32_t  ddither_carry[3], ddither_na[3], ddither_nb[3];
+static uint8_t  ddither_buf[DDITHER_MAX_WIDTH * 3];
+static uint8_t  ddither_fmt = 0xFF;
+static uint8_t  ddither_mode;
+static uint16_t ddither_width;
+static uint32_t ddither_y;
+
+/* Constants -----------------------------------------------------------------*/
+static const uint8_t ddither_bayer[16] = {
+	 0,  8,  2, 10,
+	12,  4, 14,  6,
+	 3, 11,  1,  9,
+	15,  7, 13,  5
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Level to 8bit by Bit Replication.
+*/
+/**************************************************************************/
+static uint32_t DispDither_recon(uint32_t q, uint32_t bits)
+{
+	return ((q << (8 - bits)) | (q >> (2 * bits - 8))) & 0xFF;
+}
+
+/**************************************************************************/
+/*!
+    Build Quantize/Error/Bayer Tables for Channel.
+*/
+/**************************************************************************/
+static void DispDither_table(uint32_t c, uint32_t bits)
+{
+	uint32_t top = (1u << bits) - 1;
+	uint32_t v,q,i;
+
+	for (v = 0; v < 256; v++) {
+		/* nearest level */
+		q = (v * top + 127) / 255;
+		if ((q < top) && ((int32_t)(DispDither_recon(q + 1, bits) - v) < (int32_t)(v - DispDither_recon(q, bits)))) q++;
+		if ((q > 0) && (v < DispDither_recon(q, bits)) &&
+			((int32_t)(DispDither_recon(q, bits) - v) > (int32_t)(v - DispDither_recon(q - 1, bits)))) q--;
+		ddither_q[c][v] = (uint8_t)q;
+		ddither_e[c][v] = (int8_t)((int32_t)v - (int32_t)DispDither_recon(q, bits));
+	}
+
+	/* threshold centred on zero,one level step across the matrix */
+	for (i = 0; i < 16; i++) {
+		ddither_ofs[c][i] = (int8_t)(((int32_t)ddither_bayer[i] * 2 - 15) * 255 / (int32_t)(32 * top));
+	}
+}
+
+/**************************************************************************/
+/*!
+    Start Dithering of width Pixels Lines.
+	Tables are rebuilt only when fmt changes.
+	Returns 0 on success,-1 on unsupported fmt or width.
+*/
+/**************************************************************************/
+int DispDither_begin(uint8_t fmt, uint8_t mode, uint16_t width)
+{
+	if (!width || (width > DDITHER_MAX_WIDTH)) return -1;
+
+	if (fmt != ddither_fmt) {
+		switch (fmt) {
+		case PIXFMT_RGB565:
+			DispDither_table(0, 5); DispDither_table(1, 6); DispDither_table(2, 5);
+			break;
+		case PIXFMT_RGB444:
+			DispDither_table(0, 4); DispDither_table(1, 4); DispDither_table(2, 4);
+			break;
+		case PIXFMT_RGB666:
+			DispDither_table(0, 6); DispDither_table(1, 6); DispDither_table(2, 6);
+			break;
+		default:
+			return -1;
+		}
+		ddither_fmt = fmt;
+	}
+
+	ddither_mode  = mode;
+	ddither_width = width;
+	ddither_y	  = 0;
+	memset(ddither_err, 0, sizeof(ddither_err));
+
+	return 0;
+}
+
+/**************************************************************************/
+/*!
+    Floyd-Steinberg One Channel,errors are kept *16.
+	7/16 right,3/16 below left,5/16 below,1/16 below right.
+*/
+/**************************************************************************/
+static inline uint32_t DispDither_fs(uint32_t c, int32_t v, uint32_t x)
+{
+	int16_t* e = &ddither_err[c][x];
+	int32_t err;
+
+	v += (ddither_carry[c] + e[1] + 8) >> 4;
+	v  = DDITHER_CLAMP(v);
+	err = ddither_e[c][v];
+
+	e[0]			 = (int16_t)(ddither_na[c] + err * 3);
+	ddither_na[c]	 = ddither_nb[c] + err * 5;
+	ddither_nb[c]	 = err;
+	ddither_carry[c] = err * 7;
+
+	return ddither_q[c][v];
+}
+
+#ifdef DDITHER_USE_SIMD
+/**************************************************************************/
+/*!
+    Ordered Dither to RGB565,8 pixels per step(host SIMD).
+	n MUST be multiple of 8,returns pixels done.
+*/
+/**************************************************************************/
+static uint32_t DispDither_simd565(uint8_t* d, const void* src, uint8_t srcfmt, uint32_t n)
+{
+	const uint8_t*  s8	= (const uint8_t*)src;
+	const uint32_t* s32 = (const uint32_t*)src;
+	const int8_t*   o[3];
+	uint32_t x,i;
+
+	for (i = 0; i < 3; i++) o[i] = &ddither_ofs[i][(ddither_y & 3) * 4];
+
+#if defined(__SSE2__)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128i top  = _mm_set1_epi16(255);
+		__m128i m8	 = _mm_set1_epi32(0xFF);
+		__m128i ofr  = _mm_setr_epi16(o[0][0], o[0][1], o[0][2], o[0][3], o[0][0], o[0][1], o[0][2], o[0][3]);
+		__m128i ofg  = _mm_setr_epi16(o[1][0], o[1][1], o[1][2], o[1][3], o[1][0], o[1][1], o[1][2], o[1][3]);
+		__m128i ofb  = _mm_setr_epi16(o[2][0], o[2][1], o[2][2], o[2][3], o[2][0], o[2][1], o[2][2], o[2][3]);
+		__m128i r,g,b,lo,hi;
+
+		for (x = 0; x < n; x += 8) {
+			if (srcfmt == DDITHER_SRC_ARGB8888) {
+				lo = _mm_loadu_si128((const __m128i*)&s32[x]);
+				hi = _mm_loadu_si128((const __m128i*)&s32[x + 4]);
+				r  = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), m8), _mm_and_si128(_mm_srli_epi32(hi, 16), m8));
+				g  = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo,  8), m8), _mm_and_si128(_mm_srli_epi32(hi,  8), m8));
+				b  = _mm_packs_epi32(_mm_and_si128(lo, m8), _mm_and_si128(hi, m8));
+			}
+			else {
+				const uint8_t* p = &s8[x * 3];
+				r = _mm_setr_epi16(p[0], p[3], p[6], p[9],	p[12], p[15], p[18], p[21]);
+				g = _mm_setr_epi16(p[1], p[4], p[7], p[10], p[13], p[16], p[19], p[22]);
+				b = _mm_setr_epi16(p[2], p[5], p[8], p[11], p[14], p[17], p[20], p[23]);
+			}
+
+			r = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(r, ofr), zero), top);
+			g = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(g, ofg), zero), top);
+			b = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(b, ofb), zero), top);
+			r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(DDITHER_Q5_M)), _mm_set1_epi16(DDITHER_Q5_K)), DDITHER_Q5_S);
+			g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi16(DDITHER_Q6_M)), _mm_set1_epi16(DDITHER_Q6_K)), DDITHER_Q6_S);
+			b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(DDITHER_Q5_M)), _mm_set1_epi16(DDITHER_Q5_K)), DDITHER_Q5_S);
+
+			lo = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+			_mm_storeu_si128((__m128i*)&d[x * 2], _mm_or_si128(_mm_slli_epi16(lo, 8), _mm_srli_epi16(lo, 8)));
+		}
+	}
+#else
+	{
+		int16x8_t  ofr = vmovl_s8(vld1_s8((const int8_t[8]){ o[0][0], o[0][1], o[0][2], o[0][3], o[0][0], o[0][1], o[0][2], o[0][3] }));
+		int16x8_t  ofg = vmovl_s8(vld1_s8((const int8_t[8]){ o[1][0], o[1][1], o[1][2], o[1][3], o[1][0], o[1][1], o[1][2], o[1][3] }));
+		int16x8_t  ofb = vmovl_s8(vld1_s8((const int8_t[8]){ o[2][0], o[2][1], o[2][2], o[2][3], o[2][0], o[2][1], o[2][2], o[2][3] }));
+		uint16x8_t r,g,b,v;
+		uint8x8x3_t p3;
+		uint8x8x4_t p4;
+
+		for (x = 0; x < n; x += 8) {
+			if (srcfmt == DDITHER_SRC_ARGB8888) {
+				p4 = vld4_u8((const uint8_t*)&s32[x]);		/* B,G,R,A in memory */
+				p3.val[0] = p4.val[2];
+				p3.val[1] = p4.val[1];
+				p3.val[2] = p4.val[0];
+			}
+			else {
+				p3 = vld3_u8(&s8[x * 3]);
+			}
+
+			/* add offset with clamp to 0..255 */
+			r = vreinterpretq_u16_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(p3.val[0])), ofr));
+			g = vreinterpretq_u16_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(p3.val[1])), ofg));
+			b = vreinterpretq_u16_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(p3.val[2])), ofb));
+			r = vmovl_u8(vqmovun_s16(vreinterpretq_s16_u16(r)));
+			g = vmovl_u8(vqmovun_s16(vreinterpretq_s16_u16(g)));
+			b = vmovl_u8(vqmovun_s16(vreinterpretq_s16_u16(b)));
+
+			r = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(DDITHER_Q5_K), r, DDITHER_Q5_M), DDITHER_Q5_S);
+			g = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(DDITHER_Q6_K), g, DDITHER_Q6_M), DDITHER_Q6_S);
+			b = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(DDITHER_Q5_K), b, DDITHER_Q5_M), DDITHER_Q5_S);
+
+			v = vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b);
+			vst1q_u8(&d[x * 2], vrev16q_u8(vreinterpretq_u8_u16(v)));
+		}
+	}
+#endif
+
+	return n;
+}
+#endif
+
+/**************************************************************************/
+/*!
+    Dither One Line into dst in Bus Byte Order.
+	RGB444 odd last pixel is sent as R G B 0.
+	Returns bytes written to dst.
+*/
+/**************************************************************************/
+uint32_t DispDither_line(uint8_t* dst, const void* src, uint8_t srcfmt)
+{
+	const uint8_t*  s8	= (const uint8_t*)src;
+	const uint32_t* s32 = (const uint32_t*)src;
+	const int8_t*   ofs[3];
+	uint8_t* d = dst;
+	uint32_t x,r,g,b,half = 0;
+	int32_t  c;
+
+	ofs[0] = &ddither_ofs[0][(ddither_y & 3) * 4];
+	ofs[1] = &ddither_ofs[1][(ddither_y & 3) * 4];
+	ofs[2] = &ddither_ofs[2][(ddither_y & 3) * 4];
+	for (c = 0; c < 3; c++) ddither_carry[c] = ddither_na[c] = ddither_nb[c] = 0;
+
+	x = 0;
+#ifdef DDITHER_USE_SIMD
+	if ((ddither_mode == DDITHER_ORDERED) && (ddither_fmt == PIXFMT_RGB565)) {
+		x   = DispDither_simd565(d, src, srcfmt, ddither_width & ~7u);
+		d  += x * 2;
+		s8 += x * 3;
+	}
+#endif
+	for (; x < ddither_width; x++) {
+		if (srcfmt == DDITHER_SRC_ARGB8888) {
+			r = (s32[x] >> 16) & 0xFF;
+			g = (s32[x] >>  8) & 0xFF;
+			b = (s32[x]      ) & 0xFF;
+		}
+		else {
+			r = s8[0]; g = s8[1]; b = s8[2];
+			s8 += 3;
+		}
+
+		if (ddither_mode == DDITHER_DIFFUSE) {
+			r = DispDither_fs(0, (int32_t)r, x);
+			g = DispDither_fs(1, (int32_t)g, x);
+			b = DispDither_fs(2, (int32_t)b, x);
+		}
+		else {
+			c = (int32_t)r + ofs[0][x & 3]; r = ddither_q[0][DDITHER_CLAMP(c)];
+			c = (int32_t)g + ofs[1][x & 3]; g = ddither_q[1][DDITHER_CLAMP(c)];
+			c = (int32_t)b + ofs[2][x & 3]; b = ddither_q[2][DDITHER_CLAMP(c)];
+		}
+
+		switch (ddither_fmt) {
+		case PIXFMT_RGB444:
+			/* R1G1 B1R2 G2B2 */
+			if (!(x & 1)) {
+				*d++ = (uint8_t)(r << 4 | g);
+				half = b << 4;
+			}
+			else {
+				*d++ = (uint8_t)(half | r);
+				*d++ = (uint8_t)(g << 4 | b);
+			}
+			break;
+		case PIXFMT_RGB666:
+			*d++ = (uint8_t)(r << 2);
+			*d++ = (uint8_t)(g << 2);
+			*d++ = (uint8_t)(b << 2);
+			break;
+		default:
+			*d++ = (uint8_t)(r << 3 | g >> 3);
+			*d++ = (uint8_t)(g << 5 | b);
+			break;
+		}
+	}
+	if ((ddither_fmt == PIXFMT_RGB444) && (ddither_width & 1)) *d++ = (uint8_t)half;
+
+	/* last pixel below error */
+	if (ddither_mode == DDITHER_DIFFUSE) {
+		for (c = 0; c < 3; c++) ddither_err[c][ddither_width] = (int16_t)ddither_na[c];
+	}
+	ddither_y++;
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*!
+    Dither 24bit Image into Window(END point manner).
+	stride is source bytes per line.
+	RGB444/666 are sent through PixFmt_begin(),the controller interface
+	format is switched by ops->set_fmt and restored after.
+	RGB444 width MUST be even on multi-line window.
+	Returns 0 on success,-1 on unsupported fmt or width,or the driver
+	lacks fmt(nothing is sent).
+*/
+/**************************************************************************/
+int DispDither_blit(uint16_t x, uint16_t width, uint16_t y, uint16_t height, const void* src, uint32_t stride, uint8_t srcfmt, uint8_t fmt, uint8_t mode, const DispOps_t* ops)
+{
+	const uint8_t* s = (const uint8_t*)src;
+	uint32_t j;
+
+	if ((fmt == PIXFMT_RGB444) && !((width - x) & 1) && (height > y)) return -1;
+	if (DispDither_begin(fmt, mode, (uint16_t)(width - x + 1))) return -1;
+	if (PixFmt_begin(ops, fmt, x, width, y, height)) return -1;
+
+	for (j = y; j <= height; j++, s += stride) {
+		PixFmt_write(ddither_buf, DispDither_line(ddither_buf, s, srcfmt));
+	}
+	PixFmt_end();
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
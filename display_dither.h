@@ -0,0 +1,65 @@
+/********************************************************************************/
+/*!
+	@file			display_dither.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Line Based Dithering Stage for 24bit Sources.			@n
+					Ordered(4x4 Bayer) and Floyd-Steinberg to RGB565/444/666.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Sent RGB444/666 through PixFmt_begin().
+		2026.10.19	V3.00	Added host SIMD(SSE2/NEON) ordered RGB565.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_DITHER_H
+#define DISPLAY_DITHER_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+#include "display_pixfmt.h"
+
+/* Longest line(pixels),error line and output buffer are sized by this */
+#ifndef DDITHER_MAX_WIDTH
+ #define DDITHER_MAX_WIDTH	320
+#endif
+
+/* Host SIMD(SSE2/NEON) for ordered RGB565 lines,plain C on Cortex-M */
+#if !defined(DDITHER_NO_SIMD) && (defined(__SSE2__) || defined(__ARM_NEON))
+ #define DDITHER_USE_SIMD
+#endif
+
+/* Source Formats */
+#define DDITHER_SRC_RGB888		0			/* 3bytes/pixel R,G,B */
+#define DDITHER_SRC_ARGB8888	1			/* native uint32_t,alpha ignored */
+
+/* Dither Modes */
+#define DDITHER_ORDERED			0			/* 4x4 Bayer matrix */
+#define DDITHER_DIFFUSE			1			/* Floyd-Steinberg error diffusion */
+
+/* Output is PIXFMT_RGB565,PIXFMT_RGB444 or PIXFMT_RGB666 in bus byte order.
+   DispDither_blit sets the controller by ops->set_fmt(DISPOPS_DRIVER_FMT),
+   DispDither_line output is sent by the caller. */
+
+/* Dither Functions Prototype */
+extern int DispDither_begin(uint8_t fmt, uint8_t mode, uint16_t width);
+extern uint32_t DispDither_line(uint8_t* dst, const void* src, uint8_t srcfmt);
+extern int DispDither_blit(uint16_t x, uint16_t width, uint16_t y, uint16_t height, const void* src, uint32_t stride, uint8_t srcfmt, uint8_t fmt, uint8_t mode, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_DITHER_H */
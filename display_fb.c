@@ -0,0 +1,270 @@
+/********************************************************************************/
+/*!
+	@file			display_fb.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Software Framebuffer Engine for RGB/DSI-Interface Panels.	@n
+					Portable C,works on the host against a plain array too.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Rejected off screen window.
+		2026.10.19	V3.00	Block data is MSB first by default.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_fb.h"
+/* check header file version for fool proof */
+#if DISPLAY_FB_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+DispFB_t DispFB;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Fill One Line with 32/64bit Stores.
+*/
+/**************************************************************************/
+static inline void DispFB_fill_line(uint16_t* d, uint32_t n, uint16_t colour)
+{
+	uint32_t  w = (uint32_t)colour | ((uint32_t)colour<<16);
+	uint32_t* d32;
+
+	/* align to 32bit */
+	if (((uintptr_t)d & 2) && n) {
+		*d++ = colour;
+		n--;
+	}
+
+#ifdef DISPFB_USE_64BIT_STORE
+	/* align to 64bit */
+	if (((uintptr_t)d & 4) && (n >= 2)) {
+		*(uint32_t*)d = w;
+		d += 2;
+		n -= 2;
+	}
+	{
+		uint64_t  q   = (uint64_t)w | ((uint64_t)w<<32);
+		uint64_t* d64 = (uint64_t*)d;
+
+		for (; n >= 4; n -= 4) *d64++ = q;
+		d = (uint16_t*)d64;
+	}
+#endif
+
+	d32 = (uint32_t*)d;
+	for (; n >= 2; n -= 2) *d32++ = w;
+	d = (uint16_t*)d32;
+
+	if (n) *d = colour;
+}
+
+/**************************************************************************/
+/*!
+    Initialize Framebuffer Engine.
+	buf1 = NULL means single buffer(draw directly to the front).
+*/
+/**************************************************************************/
+void DispFB_init(uint16_t* buf0, uint16_t* buf1, uint32_t width, uint32_t height)
+{
+	DispFB.buf[0]	= buf0;
+	DispFB.buf[1]	= buf1;
+	DispFB.width	= width;
+	DispFB.height	= height;
+	DispFB.stride	= width;
+	DispFB.back		= (buf1 != NULL) ? 1 : 0;
+	DispFB.swap_req	= 0;
+
+	DispFB_rect(0,width-1,0,height-1);
+}
+
+/**************************************************************************/
+/*!
+    Set Swap Hook.
+	Called at vblank with new front buffer (e.g. reload LTDC address).
+*/
+/**************************************************************************/
+void DispFB_set_swap_hook(void (*hook)(uint16_t* front))
+{
+	DispFB.swap_hook = hook;
+}
+
+/**************************************************************************/
+/*!
+    Set Rectangle.
+	Same manner as the command-mode drivers,width/height are END point.
+	End points are clamped to the screen,a window starting off screen
+	or behind its end is empty and drops the pixel data.
+*/
+/**************************************************************************/
+void DispFB_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	if (width  >= DispFB.width)  width  = DispFB.width  - 1;
+	if (height >= DispFB.height) height = DispFB.height - 1;
+
+	if ((x > width) || (y > height)) {
+		/* empty window(x0 > x1) */
+		DispFB.x0 = DispFB.cx = 1;
+		DispFB.x1 = 0;
+		DispFB.y0 = DispFB.cy = DispFB.y1 = 0;
+		return;
+	}
+
+	DispFB.x0 = DispFB.cx = x;
+	DispFB.x1 = width;
+	DispFB.y0 = DispFB.cy = y;
+	DispFB.y1 = height;
+}
+
+/**************************************************************************/
+/*!
+    Write One Pixel and Advance Cursor.
+*/
+/**************************************************************************/
+void DispFB_wr_gram(uint16_t gram)
+{
+	if (DispFB.x0 > DispFB.x1) return;
+
+	DispFB.buf[DispFB.back][DispFB.cy * DispFB.stride + DispFB.cx] = gram;
+
+	if (++DispFB.cx > DispFB.x1) {
+		DispFB.cx = DispFB.x0;
+		if (++DispFB.cy > DispFB.y1) DispFB.cy = DispFB.y0;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Write Block Data,Row-Wise Copy within Window.
+*/
+/**************************************************************************/
+void DispFB_wr_block(uint8_t *p, unsigned int cnt)
+{
+	uint32_t n = cnt / 2;
+	uint32_t k;
+	uint16_t* d;
+
+	if (DispFB.x0 > DispFB.x1) return;
+
+	while (n) {
+		k = DispFB.x1 - DispFB.cx + 1;
+		if (k > n) k = n;
+
+		d = &DispFB.buf[DispFB.back][DispFB.cy * DispFB.stride + DispFB.cx];
+#ifdef DISPFB_BLOCK_BIGENDIAN
+		{
+			uint32_t i;
+			for (i = 0; i < k; i++, p += 2) d[i] = (uint16_t)(*(p+1)|*(p)<<8);
+		}
+#else
+		memcpy(d, p, k * 2);
+		p += k * 2;
+#endif
+		n -= k;
+		DispFB.cx += k;
+
+		if (DispFB.cx > DispFB.x1) {
+			DispFB.cx = DispFB.x0;
+			if (++DispFB.cy > DispFB.y1) DispFB.cy = DispFB.y0;
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Fill Current Window.
+*/
+/**************************************************************************/
+void DispFB_fill(uint16_t colour)
+{
+	uint32_t  w = DispFB.x1 - DispFB.x0 + 1;
+	uint32_t  y;
+	uint16_t* d = &DispFB.buf[DispFB.back][DispFB.y0 * DispFB.stride + DispFB.x0];
+
+	if (DispFB.x0 > DispFB.x1) return;
+
+	if (w == DispFB.stride) {
+		/* contiguous window,fill at once */
+		DispFB_fill_line(d, w * (DispFB.y1 - DispFB.y0 + 1), colour);
+	}
+	else {
+		for (y = DispFB.y0; y <= DispFB.y1; y++, d += DispFB.stride) {
+			DispFB_fill_line(d, w, colour);
+		}
+	}
+
+	DispFB.cx = DispFB.x0;
+	DispFB.cy = DispFB.y0;
+}
+
+/**************************************************************************/
+/*!
+    Clear Display.
+*/
+/**************************************************************************/
+void DispFB_clear(void)
+{
+	DispFB_rect(0,DispFB.width-1,0,DispFB.height-1);
+	DispFB_fill(0x0000);
+}
+
+/**************************************************************************/
+/*!
+    Request Buffer Swap.
+	Swap is done in DispFB_vblank(),wait swap_req cleared before drawing.
+*/
+/**************************************************************************/
+void DispFB_swap(void)
+{
+	if (DispFB.buf[1] == NULL) return;
+	DispFB.swap_req = 1;
+}
+
+/**************************************************************************/
+/*!
+    Vertical Blank Handler.
+	Call from LTDC line/reload interrupt(target) or frame loop(host).
+*/
+/**************************************************************************/
+void DispFB_vblank(void)
+{
+	if (!DispFB.swap_req) return;
+
+	DispFB.back ^= 1;
+	DispFB.swap_req = 0;
+
+	if (DispFB.swap_hook) DispFB.swap_hook(DispFB_front());
+}
+
+/**************************************************************************/
+/*!
+    Get Front(Displayed) / Back(Drawing) Buffer.
+*/
+/**************************************************************************/
+uint16_t* DispFB_front(void)
+{
+	return (DispFB.buf[1] == NULL) ? DispFB.buf[0] : DispFB.buf[DispFB.back ^ 1];
+}
+
+uint16_t* DispFB_back(void)
+{
+	return DispFB.buf[DispFB.back];
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
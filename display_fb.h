@@ -0,0 +1,73 @@
+/********************************************************************************/
+/*!
+	@file			display_fb.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Software Framebuffer Engine for RGB/DSI-Interface Panels.	@n
+					Portable C,works on the host against a plain array too.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Rejected off screen window.
+		2026.10.19	V3.00	Block data is MSB first by default.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_FB_H
+#define DISPLAY_FB_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Use 64bit store on fill routine (default on 64bit host) */
+#if !defined(DISPFB_USE_64BIT_STORE) && (UINTPTR_MAX > 0xFFFFFFFFu)
+ #define DISPFB_USE_64BIT_STORE
+#endif
+
+/* Block data is MSB first (same as SPI/i8080 wr_block) */
+/* If caller passes pixels in CPU byte order,define DISPFB_BLOCK_NATIVE */
+#if !defined(DISPFB_BLOCK_NATIVE) && !defined(DISPFB_BLOCK_BIGENDIAN)
+ #define DISPFB_BLOCK_BIGENDIAN
+#endif
+
+/* Framebuffer Engine State */
+typedef struct {
+	uint16_t*	buf[2];				/* [0]/[1] framebuffer,buf[1]=NULL on single buffer */
+	uint32_t	width;				/* pixels per line */
+	uint32_t	height;				/* lines */
+	uint32_t	stride;				/* pixels per line in memory */
+	uint8_t		back;				/* index of drawing buffer */
+	volatile uint8_t swap_req;		/* swap requested,done at vblank */
+	uint32_t	x0,x1,y0,y1;		/* write window (inclusive) */
+	uint32_t	cx,cy;				/* write cursor */
+	void		(*swap_hook)(uint16_t* front);
+} DispFB_t;
+
+extern DispFB_t DispFB;
+
+/* Framebuffer Engine Functions Prototype */
+extern void DispFB_init(uint16_t* buf0, uint16_t* buf1, uint32_t width, uint32_t height);
+extern void DispFB_set_swap_hook(void (*hook)(uint16_t* front));
+extern void DispFB_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
+extern void DispFB_wr_gram(uint16_t gram);
+extern void DispFB_wr_block(uint8_t* blockdata,unsigned int datacount);
+extern void DispFB_fill(uint16_t colour);
+extern void DispFB_clear(void);
+extern void DispFB_swap(void);
+extern void DispFB_vblank(void);
+extern uint16_t* DispFB_front(void);
+extern uint16_t* DispFB_back(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_FB_H */
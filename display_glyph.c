@@ -0,0 +1,228 @@
+/********************************************************************************/
+/*!
+	@file			display_glyph.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Table-Driven Glyph Expansion and String Blitter.			@n
+					1bpp and 2/4bpp anti-aliased fonts,one window per string.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Skip table rebuild on same colours.
+		2026.10.19	V3.00	Added DispGlyph_get_colour.
+		2026.10.19	V4.00	String tail sent by DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_glyph.h"
+/* check header file version for fool proof */
+#if DISPLAY_GLYPH_H != 0x0400
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+/* Line buffer holds two rows,+1 carry pixel,+8 pixels overrun of kernels */
+#define DGLYPH_CAP			(DGLYPH_LINE_PIXELS*2)
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  dglyph_nib[16][8];			/* 1bpp:nibble -> 4 pixels */
+static uint8_t  dglyph_pair2[16][4];		/* 2bpp:nibble -> 2 pixels */
+static uint8_t  dglyph_pair4[256][4];		/* 4bpp:byte   -> 2 pixels */
+static uint8_t  dglyph_line[(DGLYPH_CAP + 1 + 8) * 2];
+static uint16_t dglyph_fg, dglyph_bg;
+static uint8_t  dglyph_valid;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Blend RGB565 per channel,a = 0(bg)..15(fg).
+*/
+/**************************************************************************/
+static uint16_t DispGlyph_blend(uint16_t fg, uint16_t bg, uint32_t a)
+{
+	uint32_t r = (((fg >> 11)       ) * a + ((bg >> 11)       ) * (15 - a) + 7) / 15;
+	uint32_t g = (((fg >>  5) & 0x3F) * a + ((bg >>  5) & 0x3F) * (15 - a) + 7) / 15;
+	uint32_t b = (((fg      ) & 0x1F) * a + ((bg      ) & 0x1F) * (15 - a) + 7) / 15;
+
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**************************************************************************/
+/*!
+    Set Foreground/Background and Rebuild Expansion Tables.
+	Tables hold pixels in bus byte order(MSB first).
+	Same colours as current tables are not rebuilt.
+*/
+/**************************************************************************/
+void DispGlyph_set_colour(uint16_t fg, uint16_t bg)
+{
+	uint16_t lev[16];
+	uint32_t i,k;
+	uint16_t c;
+
+	if (dglyph_valid && (dglyph_fg == fg) && (dglyph_bg == bg)) return;
+	dglyph_fg	 = fg;
+	dglyph_bg	 = bg;
+	dglyph_valid = 1;
+
+	for (i = 0; i < 16; i++) lev[i] = DispGlyph_blend(fg, bg, i);
+
+	for (i = 0; i < 16; i++) {
+		for (k = 0; k < 4; k++) {
+			c = (i & (8 >> k)) ? fg : bg;
+			dglyph_nib[i][k*2]   = (uint8_t)(c >> 8);
+			dglyph_nib[i][k*2+1] = (uint8_t)c;
+		}
+		/* 2bpp level v = 4bpp level v*5 */
+		dglyph_pair2[i][0] = (uint8_t)(lev[(i >> 2) * 5] >> 8);
+		dglyph_pair2[i][1] = (uint8_t)(lev[(i >> 2) * 5]);
+		dglyph_pair2[i][2] = (uint8_t)(lev[(i & 3) * 5] >> 8);
+		dglyph_pair2[i][3] = (uint8_t)(lev[(i & 3) * 5]);
+	}
+	for (i = 0; i < 256; i++) {
+		dglyph_pair4[i][0] = (uint8_t)(lev[i >> 4] >> 8);
+		dglyph_pair4[i][1] = (uint8_t)(lev[i >> 4]);
+		dglyph_pair4[i][2] = (uint8_t)(lev[i & 15] >> 8);
+		dglyph_pair4[i][3] = (uint8_t)(lev[i & 15]);
+	}
+}
+
+/**************************************************************************/
+/*!
+    Get Current Foreground/Background,returns 0 if never set.
+*/
+/**************************************************************************/
+uint8_t DispGlyph_get_colour(uint16_t* fg, uint16_t* bg)
+{
+	*fg = dglyph_fg;
+	*bg = dglyph_bg;
+	return dglyph_valid;
+}
+
+/**************************************************************************/
+/*!
+    Get Glyph Bitmap and Width,NULL if not in the font.
+*/
+/**************************************************************************/
+const uint8_t* DispGlyph_get(const DispFont_t* font, uint8_t c, uint8_t* width)
+{
+	uint32_t idx;
+
+	if ((c < font->first) || (c > font->last)) return NULL;
+	idx = c - font->first;
+
+	*width = font->widths ? font->widths[idx] : font->width;
+	if (font->offset) return font->bitmap + font->offset[idx];
+
+	return font->bitmap + idx * (uint32_t)font->height * ((font->width * font->bpp + 7) / 8);
+}
+
+/**************************************************************************/
+/*!
+    Expand One Glyph Row to RGB565,8 pixels per source byte(1bpp).
+	May write up to 7 pixels beyond width,returns end of this row.
+*/
+/**************************************************************************/
+uint8_t* DispGlyph_expand_row(uint8_t* dst, const uint8_t* row, uint32_t width, uint8_t bpp)
+{
+	uint8_t* end = dst + width * 2;
+	uint32_t n;
+
+	switch (bpp) {
+	case 1:
+		for (n = (width + 7) >> 3; n; n--, row++) {
+			memcpy(dst,     dglyph_nib[*row >> 4],   8);
+			memcpy(dst + 8, dglyph_nib[*row & 0x0F], 8);
+			dst += 16;
+		}
+		break;
+	case 2:
+		for (n = (width + 3) >> 2; n; n--, row++) {
+			memcpy(dst,     dglyph_pair2[*row >> 4],   4);
+			memcpy(dst + 4, dglyph_pair2[*row & 0x0F], 4);
+			dst += 8;
+		}
+		break;
+	default:
+		for (n = (width + 1) >> 1; n; n--, row++) {
+			memcpy(dst, dglyph_pair4[*row], 4);
+			dst += 4;
+		}
+		break;
+	}
+
+	return end;
+}
+
+/**************************************************************************/
+/*!
+    Get String Width in Pixels(clipped to DGLYPH_LINE_PIXELS).
+*/
+/**************************************************************************/
+uint32_t DispGlyph_string_width(const DispFont_t* font, const char* str)
+{
+	uint32_t w = 0;
+	uint8_t  gw;
+
+	for (; *str; str++) {
+		if (!DispGlyph_get(font, (uint8_t)*str, &gw)) continue;
+		if (w + gw > DGLYPH_LINE_PIXELS) break;
+		w += gw;
+	}
+
+	return w;
+}
+
+/**************************************************************************/
+/*!
+    Draw String with Current Colours.
+	Whole string is one window,rows are expanded back to back and sent
+	by wr_block in multiple of 4 bytes,odd pixel carried to next row.
+*/
+/**************************************************************************/
+void DispGlyph_string(uint16_t x, uint16_t y, const DispFont_t* font, const char* str, const DispOps_t* ops)
+{
+	uint32_t w = DispGlyph_string_width(font, str);
+	uint8_t* d = dglyph_line;
+	uint32_t j,send,used,stride;
+	const char* s;
+	const uint8_t* g;
+	uint8_t gw;
+
+	if (!w) return;
+	ops->rect(x, x + w - 1, y, y + font->height - 1);
+
+	for (j = 0; j < font->height; j++) {
+		if ((uint32_t)(d - dglyph_line) / 2 + w > DGLYPH_CAP + 1) {
+			send = (uint32_t)(d - dglyph_line) & ~3u;
+			ops->wr_block(dglyph_line, send);
+			if ((d - dglyph_line) & 2) memcpy(dglyph_line, dglyph_line + send, 2);
+			d = dglyph_line + ((d - dglyph_line) & 2);
+		}
+
+		used = 0;
+		for (s = str; *s; s++) {
+			g = DispGlyph_get(font, (uint8_t)*s, &gw);
+			if (!g) continue;
+			if (used + gw > w) break;
+			stride = ((uint32_t)gw * font->bpp + 7) / 8;
+			d = DispGlyph_expand_row(d, g + j * stride, gw, font->bpp);
+			used += gw;
+		}
+	}
+
+	DispOps_emit(ops, dglyph_line, (uint32_t)(d - dglyph_line));
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
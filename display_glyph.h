@@ -0,0 +1,65 @@
+/********************************************************************************/
+/*!
+	@file			display_glyph.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Table-Driven Glyph Expansion and String Blitter.			@n
+					1bpp and 2/4bpp anti-aliased fonts,one window per string.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Skip table rebuild on same colours.
+		2026.10.19	V3.00	Added DispGlyph_get_colour.
+		2026.10.19	V4.00	String tail sent by DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_GLYPH_H
+#define DISPLAY_GLYPH_H 0x0400
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Line buffer(pixels),longer strings are clipped */
+#ifndef DGLYPH_LINE_PIXELS
+ #define DGLYPH_LINE_PIXELS	480
+#endif
+
+/* Font Description
+   Each glyph row is (width*bpp+7)/8 bytes,MSB first(left pixel),
+   glyph data is height rows. */
+typedef struct {
+	const uint8_t*	bitmap;			/* glyph data of first..last */
+	const uint32_t*	offset;			/* byte offset per glyph,NULL = fixed size */
+	const uint8_t*	widths;			/* width per glyph(with offset),NULL = fixed width */
+	uint8_t			width;			/* fixed width */
+	uint8_t			height;
+	uint8_t			bpp;			/* 1,2 or 4 */
+	uint8_t			first;
+	uint8_t			last;
+} DispFont_t;
+
+/* Glyph Expansion Functions Prototype */
+extern void DispGlyph_set_colour(uint16_t fg, uint16_t bg);
+extern uint8_t DispGlyph_get_colour(uint16_t* fg, uint16_t* bg);
+extern const uint8_t* DispGlyph_get(const DispFont_t* font, uint8_t c, uint8_t* width);
+extern uint8_t* DispGlyph_expand_row(uint8_t* dst, const uint8_t* row, uint32_t width, uint8_t bpp);
+extern uint32_t DispGlyph_string_width(const DispFont_t* font, const char* str);
+extern void DispGlyph_string(uint16_t x, uint16_t y, const DispFont_t* font, const char* str, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_GLYPH_H */
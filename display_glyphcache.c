@@ -0,0 +1,283 @@
+/********************************************************************************/
+/*!
+	@file			display_glyphcache.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          LRU Cache of Pre-Expanded RGB565 Glyphs.					@n
+					Fixed arena,cached glyphs go to wr_block(DMA) as is.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Hashed lookup,keep caller colours.
+		2026.10.19	V3.00	Colours switched once per call.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_glyphcache.h"
+/* check header file version for fool proof */
+#if DISPLAY_GLYPHCACHE_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+/* +8 pixels for overrun of expansion kernels */
+#define DGCACHE_SLOT_WORDS	((DGCACHE_SLOT_PIXELS + 8) / 2)
+#define DGCACHE_NIL			0xFF
+
+#if DGCACHE_SLOTS > 255
+ #error "DGCACHE_SLOTS MUST be less than 256!"
+#endif
+#if DGCACHE_BUCKETS & (DGCACHE_BUCKETS - 1)
+ #error "DGCACHE_BUCKETS MUST be power of 2!"
+#endif
+
+/* Variables -----------------------------------------------------------------*/
+DispGCache_Stat_t DispGCache_Stat;
+
+static struct {
+	const DispFont_t*	font;
+	uint16_t			fg, bg;
+	uint8_t				c;
+	uint8_t				width;
+	uint8_t				prev, next;		/* LRU list,head = most recent */
+	uint8_t				hash, hnext;	/* bucket and chain in it */
+} dgcache_key[DGCACHE_SLOTS];
+static uint32_t dgcache_arena[DGCACHE_SLOTS][DGCACHE_SLOT_WORDS];
+static uint8_t  dgcache_head, dgcache_tail;
+static uint8_t  dgcache_bucket[DGCACHE_BUCKETS];
+static uint16_t dgcache_sfg, dgcache_sbg;		/* caller DispGlyph colours */
+static uint8_t  dgcache_saved, dgcache_switched;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize(Flush) Cache.
+*/
+/**************************************************************************/
+void DispGCache_init(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < DGCACHE_SLOTS; i++) {
+		dgcache_key[i].font = NULL;
+		dgcache_key[i].prev = (uint8_t)((i == 0) ? DGCACHE_NIL : i - 1);
+		dgcache_key[i].next = (uint8_t)((i == DGCACHE_SLOTS - 1) ? DGCACHE_NIL : i + 1);
+	}
+	dgcache_head = 0;
+	dgcache_tail = DGCACHE_SLOTS - 1;
+	memset(dgcache_bucket, DGCACHE_NIL, sizeof(dgcache_bucket));
+	memset(&DispGCache_Stat, 0, sizeof(DispGCache_Stat));
+}
+
+/**************************************************************************/
+/*!
+    Hash Bucket of Glyph Key.
+*/
+/**************************************************************************/
+static uint8_t DispGCache_hash(const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg)
+{
+	uint32_t h = (uint32_t)(uintptr_t)font ^ c ^ ((uint32_t)fg << 16 | bg);
+
+	h *= 0x9E3779B1u;
+	return (uint8_t)((h >> 16) & (DGCACHE_BUCKETS - 1));
+}
+
+/**************************************************************************/
+/*!
+    Remove Slot from its Hash Chain.
+*/
+/**************************************************************************/
+static void DispGCache_unhash(uint8_t i)
+{
+	uint8_t* p = &dgcache_bucket[dgcache_key[i].hash];
+
+	while (*p != i) p = &dgcache_key[*p].hnext;
+	*p = dgcache_key[i].hnext;
+}
+
+/**************************************************************************/
+/*!
+    Move Slot to Head of LRU List.
+*/
+/**************************************************************************/
+static void DispGCache_touch(uint8_t i)
+{
+	if (i == dgcache_head) return;
+
+	/* unlink */
+	dgcache_key[dgcache_key[i].prev].next = dgcache_key[i].next;
+	if (dgcache_key[i].next != DGCACHE_NIL)	dgcache_key[dgcache_key[i].next].prev = dgcache_key[i].prev;
+	else									dgcache_tail = dgcache_key[i].prev;
+
+	/* push front */
+	dgcache_key[i].prev = DGCACHE_NIL;
+	dgcache_key[i].next = dgcache_head;
+	dgcache_key[dgcache_head].prev = i;
+	dgcache_head = i;
+}
+
+/**************************************************************************/
+/*!
+    Switch DispGlyph Tables to fg/bg,once per public call.
+	Caller colours are saved for DispGCache_restore.
+*/
+/**************************************************************************/
+static void DispGCache_colour(uint16_t fg, uint16_t bg)
+{
+	if (dgcache_switched) return;
+	dgcache_saved	 = DispGlyph_get_colour(&dgcache_sfg, &dgcache_sbg);
+	dgcache_switched = 1;
+	DispGlyph_set_colour(fg, bg);
+}
+
+static void DispGCache_restore(void)
+{
+	if (dgcache_switched && dgcache_saved) DispGlyph_set_colour(dgcache_sfg, dgcache_sbg);
+	dgcache_switched = 0;
+}
+
+/**************************************************************************/
+/*!
+    Lookup Glyph,expand into least recent slot on miss.
+*/
+/**************************************************************************/
+static const uint8_t* DispGCache_lookup(const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, uint8_t* width)
+{
+	const uint8_t* g;
+	uint8_t* d;
+	uint32_t j,stride;
+	uint8_t  i,h;
+
+	/* lookup in hash chain */
+	h = DispGCache_hash(font, c, fg, bg);
+	for (i = dgcache_bucket[h]; i != DGCACHE_NIL; i = dgcache_key[i].hnext) {
+		if ((dgcache_key[i].c == c) && (dgcache_key[i].font == font) &&
+			(dgcache_key[i].fg == fg) && (dgcache_key[i].bg == bg)) {
+			DispGCache_touch(i);
+			DispGCache_Stat.hits++;
+			*width = dgcache_key[i].width;
+			return (const uint8_t*)dgcache_arena[i];
+		}
+	}
+
+	g = DispGlyph_get(font, c, width);
+	if (!g) return NULL;
+	if ((uint32_t)*width * font->height > DGCACHE_SLOT_PIXELS) {
+		DispGCache_Stat.uncached++;
+		return NULL;
+	}
+
+	/* miss,reuse least recent slot */
+	DispGCache_Stat.misses++;
+	i = dgcache_tail;
+	if (dgcache_key[i].font) {
+		DispGCache_unhash(i);
+		DispGCache_Stat.evictions++;
+	}
+
+	DispGCache_colour(fg, bg);
+	d = (uint8_t*)dgcache_arena[i];
+	stride = ((uint32_t)*width * font->bpp + 7) / 8;
+	for (j = 0; j < font->height; j++) {
+		d = DispGlyph_expand_row(d, g + j * stride, *width, font->bpp);
+	}
+
+	dgcache_key[i].font	 = font;
+	dgcache_key[i].c	 = c;
+	dgcache_key[i].fg	 = fg;
+	dgcache_key[i].bg	 = bg;
+	dgcache_key[i].width = *width;
+	dgcache_key[i].hash	 = h;
+	dgcache_key[i].hnext = dgcache_bucket[h];
+	dgcache_bucket[h]	 = i;
+	DispGCache_touch(i);
+
+	return (const uint8_t*)dgcache_arena[i];
+}
+
+/**************************************************************************/
+/*!
+    Get Expanded Glyph,width*height RGB565 pixels in bus byte order.
+	Returns NULL if not in font or larger than a slot.
+	DispGlyph colours are kept as the caller set them.
+*/
+/**************************************************************************/
+const uint8_t* DispGCache_get(const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, uint8_t* width)
+{
+	const uint8_t* p = DispGCache_lookup(font, c, fg, bg, width);
+
+	DispGCache_restore();
+	return p;
+}
+
+/**************************************************************************/
+/*!
+    Draw One Character,colours are restored by the caller.
+*/
+/**************************************************************************/
+static uint8_t DispGCache_draw(uint16_t x, uint16_t y, const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, const DispOps_t* ops)
+{
+	const uint8_t* p;
+	uint8_t  w = 0;
+	char     s[2];
+
+	p = DispGCache_lookup(font, c, fg, bg, &w);
+	if (!p) {
+		if (!w) return 0;
+		/* too large,draw uncached */
+		s[0] = (char)c; s[1] = '\0';
+		DispGCache_colour(fg, bg);
+		DispGlyph_string(x, y, font, s, ops);
+		return w;
+	}
+
+	ops->rect(x, x + w - 1, y, y + font->height - 1);
+	DispOps_emit(ops, p, (uint32_t)w * font->height * 2);
+
+	return w;
+}
+
+/**************************************************************************/
+/*!
+    Draw One Character,returns its width.
+	Cached glyph is one window and one wr_block.
+*/
+/**************************************************************************/
+uint8_t DispGCache_char(uint16_t x, uint16_t y, const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, const DispOps_t* ops)
+{
+	uint8_t w = DispGCache_draw(x, y, font, c, fg, bg, ops);
+
+	DispGCache_restore();
+	return w;
+}
+
+/**************************************************************************/
+/*!
+    Draw String,returns width drawn.
+	DispGlyph colours are switched at most once for all misses.
+*/
+/**************************************************************************/
+uint32_t DispGCache_string(uint16_t x, uint16_t y, const DispFont_t* font, const char* str, uint16_t fg, uint16_t bg, const DispOps_t* ops)
+{
+	uint32_t w = 0;
+
+	while (*str) {
+		w += DispGCache_draw((uint16_t)(x + w), y, font, (uint8_t)*str++, fg, bg, ops);
+	}
+	DispGCache_restore();
+
+	return w;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,66 @@
+/********************************************************************************/
+/*!
+	@file			display_glyphcache.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          LRU Cache of Pre-Expanded RGB565 Glyphs.					@n
+					Fixed arena,cached glyphs go to wr_block(DMA) as is.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Hashed lookup,keep caller colours.
+		2026.10.19	V3.00	Colours switched once per call.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_GLYPHCACHE_H
+#define DISPLAY_GLYPHCACHE_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_glyph.h"
+
+/* Arena = DGCACHE_SLOTS * DGCACHE_SLOT_PIXELS * 2 bytes */
+#ifndef DGCACHE_SLOTS
+ #define DGCACHE_SLOTS			32
+#endif
+/* Largest cached glyph(width*height),bigger ones are drawn uncached */
+#ifndef DGCACHE_SLOT_PIXELS
+ #define DGCACHE_SLOT_PIXELS	(16*24)
+#endif
+/* Lookup hash buckets,power of 2 */
+#ifndef DGCACHE_BUCKETS
+ #define DGCACHE_BUCKETS		64
+#endif
+
+/* Cache Statistics */
+typedef struct {
+	uint32_t	hits;
+	uint32_t	misses;
+	uint32_t	evictions;
+	uint32_t	uncached;			/* glyph larger than slot */
+} DispGCache_Stat_t;
+
+extern DispGCache_Stat_t DispGCache_Stat;
+
+/* Glyph Cache Functions Prototype */
+extern void DispGCache_init(void);
+extern const uint8_t* DispGCache_get(const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, uint8_t* width);
+extern uint8_t DispGCache_char(uint16_t x, uint16_t y, const DispFont_t* font, uint8_t c, uint16_t fg, uint16_t bg, const DispOps_t* ops);
+extern uint32_t DispGCache_string(uint16_t x, uint16_t y, const DispFont_t* font, const char* str, uint16_t fg, uint16_t bg, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_GLYPHCACHE_H */
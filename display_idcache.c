@@ -0,0 +1,147 @@
+/********************************************************************************/
+/*!
+	@file			display_idcache.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Detected Controller ID Cache for Warm Reboot.				@n
+					Retained RAM or user storage,checked by one register read.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_idcache.h"
+/* check header file version for fool proof */
+#if DISPLAY_IDCACHE_H != 0x0100
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+DispIdCache_Stat_t DispIdCache_Stat;
+/* survives warm reboot,random after power on(rejected by magic and sum) */
+static DispIdCache_t didcache_ram __attribute__((section(DIDCACHE_SECTION)));
+static int  (*didcache_load)(void* buf, uint32_t size);
+static void (*didcache_save)(const void* buf, uint32_t size);
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Record Checksum(FNV-1a).
+*/
+/**************************************************************************/
+static uint32_t DispIdCache_sum(const DispIdCache_t* c)
+{
+	const uint8_t* p = (const uint8_t*)c;
+	uint32_t n = (uint32_t)((const uint8_t*)&c->sum - p);
+	uint32_t h = 2166136261u;
+
+	while (n--) {
+		h ^= *p++;
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+/**************************************************************************/
+/*!
+    Set User Storage(e.g. backup registers or flash),NULL = retained RAM.
+	load returns 0 when size bytes are read.
+*/
+/**************************************************************************/
+void DispIdCache_set_store(int (*load)(void* buf, uint32_t size), void (*save)(const void* buf, uint32_t size))
+{
+	didcache_load = load;
+	didcache_save = save;
+}
+
+/**************************************************************************/
+/*!
+    Get Cached IDs.
+	Hit only when record is valid,tag matches and check equals
+	the register value read now.
+	Returns 0 on hit(id filled),-1 then do the full probe.
+*/
+/**************************************************************************/
+int DispIdCache_load(uint32_t tag, uint16_t check, uint16_t* id, uint32_t n)
+{
+	DispIdCache_t c;
+
+	if (didcache_load) {
+		if (didcache_load(&c, sizeof(c))) goto miss;
+	}
+	else {
+		c = didcache_ram;
+	}
+
+	if ((c.magic != DIDCACHE_MAGIC) || (c.sum != DispIdCache_sum(&c)) ||
+		(c.tag != tag) || (c.check != check) || (n > DIDCACHE_IDS)) goto miss;
+
+	memcpy(id, c.id, n * sizeof(uint16_t));
+	DispIdCache_Stat.hits++;
+	return 0;
+
+miss:
+	DispIdCache_Stat.misses++;
+	return -1;
+}
+
+/**************************************************************************/
+/*!
+    Store IDs after Successful Probe.
+	Same record is not written again(flash wear in user storage).
+*/
+/**************************************************************************/
+void DispIdCache_save(uint32_t tag, uint16_t check, const uint16_t* id, uint32_t n)
+{
+	DispIdCache_t c,old;
+
+	if (n > DIDCACHE_IDS) n = DIDCACHE_IDS;
+	memset(&c, 0, sizeof(c));
+	c.magic = DIDCACHE_MAGIC;
+	c.tag	= tag;
+	c.check = check;
+	memcpy(c.id, id, n * sizeof(uint16_t));
+	c.sum	= DispIdCache_sum(&c);
+
+	if (didcache_load) {
+		if (!didcache_save) return;
+		if (!didcache_load(&old, sizeof(old)) && !memcmp(&old, &c, sizeof(c))) return;
+		didcache_save(&c, sizeof(c));
+	}
+	else {
+		if (!memcmp(&didcache_ram, &c, sizeof(c))) return;
+		didcache_ram = c;
+	}
+	DispIdCache_Stat.saves++;
+}
+
+/**************************************************************************/
+/*!
+    Drop Cached Record,next init does the full probe.
+*/
+/**************************************************************************/
+void DispIdCache_invalidate(void)
+{
+	DispIdCache_t c;
+
+	memset(&c, 0, sizeof(c));
+	if (didcache_save)	didcache_save(&c, sizeof(c));
+	else				didcache_ram = c;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
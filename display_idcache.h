@@ -0,0 +1,70 @@
+/********************************************************************************/
+/*!
+	@file			display_idcache.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Detected Controller ID Cache for Warm Reboot.				@n
+					Retained RAM or user storage,checked by one register read.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_IDCACHE_H
+#define DISPLAY_IDCACHE_H 0x0100
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Enable in MAKEFILE for drivers supporting it,e.g. -DDISPLAY_ID_CACHE */
+/* #define DISPLAY_ID_CACHE */
+
+/* Retained RAM section,MUST NOT be cleared by startup code.
+   e.g. in linker script: .noinit (NOLOAD) : { *(.noinit*) } > RAM */
+#ifndef DIDCACHE_SECTION
+ #define DIDCACHE_SECTION	".noinit"
+#endif
+
+/* ID words per record */
+#define DIDCACHE_IDS		4
+#define DIDCACHE_MAGIC		0x44494443
+
+/* Cache Record */
+typedef struct {
+	uint32_t	magic;
+	uint32_t	tag;				/* driver and interface */
+	uint16_t	check;				/* cheap register read at save time */
+	uint16_t	id[DIDCACHE_IDS];	/* probe results */
+	uint16_t	reserved;
+	uint32_t	sum;				/* FNV-1a of the above */
+} DispIdCache_t;
+
+/* Cache Statistics */
+typedef struct {
+	uint32_t	hits;
+	uint32_t	misses;
+	uint32_t	saves;				/* records actually written */
+} DispIdCache_Stat_t;
+
+extern DispIdCache_Stat_t DispIdCache_Stat;
+
+/* ID Cache Functions Prototype */
+extern void DispIdCache_set_store(int (*load)(void* buf, uint32_t size), void (*save)(const void* buf, uint32_t size));
+extern int  DispIdCache_load(uint32_t tag, uint16_t check, uint16_t* id, uint32_t n);
+extern void DispIdCache_save(uint32_t tag, uint16_t check, const uint16_t* id, uint32_t n);
+extern void DispIdCache_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_IDCACHE_H */
@@ -0,0 +1,172 @@
+/********************************************************************************/
+/*!
+	@file			display_idle.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          8-Colour Band Renderer for Partial/Idle Display Mode.		@n
+					Quantizes to 3bit colour and drops pixels out of the band.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed ops initializer,emit by DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_idle.h"
+/* check header file version for fool proof */
+#if DISPLAY_IDLE_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DIDLE_BUF_BYTES		(DIDLE_BUF_PIXELS*2)
+
+/* Variables -----------------------------------------------------------------*/
+DispIdle_Stat_t DispIdle_Stat;
+static const DispOps_t* didle_base;
+static uint16_t didle_top, didle_bottom;		/* band rows */
+static uint32_t didle_pos;						/* pixel index in window */
+static uint32_t didle_first, didle_last;		/* band part of window [first,last) */
+static uint8_t  didle_buf[DIDLE_BUF_BYTES];
+static uint32_t didle_fill;
+
+/* Constants -----------------------------------------------------------------*/
+/* MSB of R,G,B(hi bit7,hi bit2,lo bit4) -> 8 colours in bus byte order */
+static const uint8_t didle_col[8][2] = {
+	{0x00,0x00}, {0x00,0x1F}, {0x07,0xE0}, {0x07,0xFF},
+	{0xF8,0x00}, {0xF8,0x1F}, {0xFF,0xE0}, {0xFF,0xFF}
+};
+
+/* Function prototypes -------------------------------------------------------*/
+static void DispIdle_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
+static void DispIdle_wr_gram(uint16_t gram);
+static void DispIdle_wr_block(uint8_t* p, unsigned int cnt);
+
+const DispOps_t DispIdle_ops = { DispIdle_rect, DispIdle_wr_gram, DispIdle_wr_block, NULL, NULL, NULL, NULL, NULL };
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Start Band Rendering,top/bottom are rows shown in partial mode.
+*/
+/**************************************************************************/
+void DispIdle_begin(const DispOps_t* base, uint16_t top, uint16_t bottom)
+{
+	didle_base	 = base;
+	didle_top	 = top;
+	didle_bottom = bottom;
+	didle_pos	 = 0;
+	didle_first	 = 0;
+	didle_last	 = 0;
+	didle_fill	 = 0;
+}
+
+/**************************************************************************/
+/*!
+    Send Staged Pixels,odd pixel by wr_gram.
+	Called at end of each window,needed only after a short write.
+*/
+/**************************************************************************/
+void DispIdle_flush(void)
+{
+	DispOps_emit(didle_base, didle_buf, didle_fill);
+	didle_fill = 0;
+}
+
+/**************************************************************************/
+/*!
+    Set Window,clipped to the band rows.
+*/
+/**************************************************************************/
+static void DispIdle_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	uint32_t w = width - x + 1;
+	uint32_t y0 = (y > didle_top) ? y : didle_top;
+	uint32_t y1 = (height < didle_bottom) ? height : didle_bottom;
+
+	DispIdle_flush();
+	didle_pos = 0;
+
+	if (y0 > y1) {
+		didle_first = didle_last = 0;
+		return;
+	}
+	didle_first = (y0 - y) * w;
+	didle_last	= (y1 - y + 1) * w;
+	didle_base->rect(x, width, y0, y1);
+}
+
+/**************************************************************************/
+/*!
+    Quantize n Band Pixels into Staging.
+*/
+/**************************************************************************/
+static void DispIdle_put(const uint8_t* p, uint32_t n)
+{
+	const uint8_t* c;
+
+	DispIdle_Stat.sent += n;
+	while (n--) {
+		c = didle_col[((p[0] >> 5) & 4) | ((p[0] >> 1) & 2) | ((p[1] >> 4) & 1)];
+		didle_buf[didle_fill++] = c[0];
+		didle_buf[didle_fill++] = c[1];
+		p += 2;
+		if (didle_fill == DIDLE_BUF_BYTES) {
+			didle_base->wr_block(didle_buf, DIDLE_BUF_BYTES);
+			didle_fill = 0;
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Write Pixels(MSB first),out of band pixels are only counted.
+*/
+/**************************************************************************/
+static void DispIdle_wr_block(uint8_t* p, unsigned int cnt)
+{
+	uint32_t n = cnt / 2;
+	uint32_t k;
+
+	while (n) {
+		if (didle_pos < didle_first) {
+			k = didle_first - didle_pos;
+		}
+		else if (didle_pos >= didle_last) {
+			k = n;
+		}
+		else {
+			k = didle_last - didle_pos;
+			if (k > n) k = n;
+			DispIdle_put(p, k);
+			didle_pos += k;
+			if (didle_pos == didle_last) DispIdle_flush();
+			p += k * 2;
+			n -= k;
+			continue;
+		}
+		if (k > n) k = n;
+		DispIdle_Stat.dropped += k;
+		didle_pos += k;
+		p += k * 2;
+		n -= k;
+	}
+}
+
+static void DispIdle_wr_gram(uint16_t gram)
+{
+	uint8_t b[2];
+
+	b[0] = (uint8_t)(gram >> 8);
+	b[1] = (uint8_t)gram;
+	DispIdle_wr_block(b, 2);
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
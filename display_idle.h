@@ -0,0 +1,59 @@
+/********************************************************************************/
+/*!
+	@file			display_idle.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          8-Colour Band Renderer for Partial/Idle Display Mode.		@n
+					Quantizes to 3bit colour and drops pixels out of the band.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed ops initializer,emit by DispOps_emit.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_IDLE_H
+#define DISPLAY_IDLE_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Staging buffer(pixels),MUST be even */
+#ifndef DIDLE_BUF_PIXELS
+ #define DIDLE_BUF_PIXELS	64
+#endif
+
+/* RGB565 to 8 Colours,each channel takes its MSB as idle mode panel does */
+#define DIDLE_QUANTIZE(c)	((((c) & 0x8000) ? 0xF800 : 0) | (((c) & 0x0400) ? 0x07E0 : 0) | (((c) & 0x0010) ? 0x001F : 0))
+
+/* Band Statistics */
+typedef struct {
+	uint32_t	sent;				/* pixels in band */
+	uint32_t	dropped;			/* pixels out of band,not on the bus */
+} DispIdle_Stat_t;
+
+extern DispIdle_Stat_t DispIdle_Stat;
+
+/* Wrapped entry points,use in place of driver ops while in partial/idle mode */
+extern const DispOps_t DispIdle_ops;
+
+/* Idle Renderer Functions Prototype */
+extern void DispIdle_begin(const DispOps_t* base, uint16_t top, uint16_t bottom);
+extern void DispIdle_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_IDLE_H */
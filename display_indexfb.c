@@ -0,0 +1,335 @@
+/********************************************************************************/
+/*!
+	@file			display_indexfb.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Indexed-Colour(4/8bpp) Framebuffer with Palette Expansion	@n
+					in the Flush Path.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Sent RGB666 through PixFmt_begin(),rebuilt palette on output change.
+		2026.10.19	V3.00	Split expansion tables into IdxFB_Lut_t for other indexed sources.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_indexfb.h"
+/* check header file version for fool proof */
+#if DISPLAY_INDEXFB_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+IdxFB_t IdxFB;
+/* Ping-Pong Line Buffer,+3 pixels for carry over */
+static uint32_t idxfb_line[2][((IDXFB_CHUNK+4)*3+3)/4];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize Indexed Framebuffer.
+	buf0/buf1 MUST have stride*height bytes,stride=(width*bpp+7)/8.
+*/
+/**************************************************************************/
+void IdxFB_init(uint8_t* buf0, uint8_t* buf1, uint16_t width, uint16_t height, uint8_t bpp, const DispOps_t* ops)
+{
+	IdxFB.buf[0]	= buf0;
+	IdxFB.buf[1]	= buf1;
+	IdxFB.width		= width;
+	IdxFB.height	= height;
+	IdxFB.bpp		= (bpp == 4) ? 4 : 8;
+	IdxFB.stride	= (uint16_t)((width * IdxFB.bpp + 7) / 8);
+	IdxFB.lut.out	= IDXFB_OUT_RGB565;
+	IdxFB.draw		= 0;
+	IdxFB.ops		= *ops;
+}
+
+/**************************************************************************/
+/*!
+    Build Bus Order Palette Entries for lut->out.
+	rgb565[i] is entry i,first..first+num-1 are rebuilt.
+*/
+/**************************************************************************/
+void IdxFB_lut_build(IdxFB_Lut_t* lut, const uint16_t* rgb565, uint16_t first, uint16_t num, uint8_t bpp)
+{
+	uint16_t i;
+	uint8_t  c[2];
+	uint8_t* b;
+
+	for (i = first; (i < first + num) && (i < 256); i++) {
+		c[0] = (uint8_t)(rgb565[i] >> 8);
+		c[1] = (uint8_t)rgb565[i];
+		if (lut->out == IDXFB_OUT_RGB666) {
+			PixFmt_565to666(lut->pal[i], c, 1);
+		}
+		else {
+			lut->pal[i][0] = c[0];
+			lut->pal[i][1] = c[1];
+		}
+	}
+
+	/* Rebuild pair table for 4bpp,one byte = left(upper nibble) + right pixel */
+	if (bpp == 4) {
+		for (i = 0; i < 256; i++) {
+			b = (uint8_t*)&lut->pair[i];
+			b[0] = lut->pal[i >> 4][0];
+			b[1] = lut->pal[i >> 4][1];
+			b[2] = lut->pal[i & 15][0];
+			b[3] = lut->pal[i & 15][1];
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Select Output Format,palette is rebuilt for it.
+*/
+/**************************************************************************/
+void IdxFB_set_output(uint8_t out)
+{
+	if (out == IdxFB.lut.out) return;
+
+	IdxFB.lut.out = out;
+	IdxFB_lut_build(&IdxFB.lut, IdxFB.rgb, 0, 256, IdxFB.bpp);
+}
+
+/**************************************************************************/
+/*!
+    Set Palette Entries from RGB565.
+	Held as given and in bus byte order of the output format.
+*/
+/**************************************************************************/
+void IdxFB_set_palette(const uint16_t* rgb565, uint16_t first, uint16_t num)
+{
+	uint16_t i;
+
+	for (i = first; (i < first + num) && (i < 256); i++) IdxFB.rgb[i] = *rgb565++;
+	IdxFB_lut_build(&IdxFB.lut, IdxFB.rgb, first, num, IdxFB.bpp);
+}
+
+/**************************************************************************/
+/*!
+    Put One Pixel / Fill Rectangle in Drawing Buffer.
+*/
+/**************************************************************************/
+void IdxFB_pset(uint16_t x, uint16_t y, uint8_t idx)
+{
+	uint8_t* p = IdxFB.buf[IdxFB.draw] + (uint32_t)y * IdxFB.stride;
+
+	if (IdxFB.bpp == 8) {
+		p[x] = idx;
+	}
+	else {
+		p += x >> 1;
+		*p = (x & 1) ? (uint8_t)((*p & 0xF0) | (idx & 0x0F)) : (uint8_t)((*p & 0x0F) | (idx << 4));
+	}
+}
+
+void IdxFB_fill(uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint8_t idx)
+{
+	uint16_t i,j;
+	uint8_t* p;
+
+	for (j = y; j <= height; j++) {
+		if (IdxFB.bpp == 8) {
+			memset(IdxFB.buf[IdxFB.draw] + (uint32_t)j * IdxFB.stride + x, idx, width - x + 1);
+			continue;
+		}
+		i = x;
+		if (i & 1) IdxFB_pset(i++, j, idx);
+		p = IdxFB.buf[IdxFB.draw] + (uint32_t)j * IdxFB.stride + (i >> 1);
+		for (; i + 1 <= width; i += 2) *p++ = (uint8_t)((idx << 4) | (idx & 0x0F));
+		if (i <= width) IdxFB_pset(i, j, idx);
+	}
+}
+
+/**************************************************************************/
+/*!
+    Expand 8bpp Indices,4 pixels per iteration.
+*/
+/**************************************************************************/
+uint32_t IdxFB_expand8(const IdxFB_Lut_t* lut, uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	uint8_t* d = dst;
+	const uint8_t* c;
+	uint32_t n;
+
+	if (lut->out == IDXFB_OUT_RGB666) {
+		for (n = npix; n; n--) {
+			c = lut->pal[*src++];
+			*d++ = c[0]; *d++ = c[1]; *d++ = c[2];
+		}
+		return (uint32_t)(d - dst);
+	}
+
+	for (n = npix >> 2; n; n--) {
+		c = lut->pal[src[0]]; d[0] = c[0]; d[1] = c[1];
+		c = lut->pal[src[1]]; d[2] = c[0]; d[3] = c[1];
+		c = lut->pal[src[2]]; d[4] = c[0]; d[5] = c[1];
+		c = lut->pal[src[3]]; d[6] = c[0]; d[7] = c[1];
+		src += 4;
+		d   += 8;
+	}
+	for (n = npix & 3; n; n--) {
+		c = lut->pal[*src++];
+		*d++ = c[0]; *d++ = c[1];
+	}
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*!
+    Expand 4bpp Indices starting at pixel x of the line.
+	RGB565 uses pair table,8 pixels(4 bytes) per iteration.
+*/
+/**************************************************************************/
+uint32_t IdxFB_expand4(const IdxFB_Lut_t* lut, uint8_t* dst, const uint8_t* src, uint32_t x, uint32_t npix)
+{
+	uint8_t* d = dst;
+	const uint8_t* c;
+	uint32_t n;
+
+	src += x >> 1;
+
+	if (lut->out == IDXFB_OUT_RGB666) {
+		for (n = 0; n < npix; n++, x++) {
+			c = lut->pal[(x & 1) ? (*src++ & 0x0F) : (*src >> 4)];
+			*d++ = c[0]; *d++ = c[1]; *d++ = c[2];
+		}
+		return (uint32_t)(d - dst);
+	}
+
+	/* odd start */
+	if ((x & 1) && npix) {
+		c = lut->pal[*src++ & 0x0F];
+		*d++ = c[0]; *d++ = c[1];
+		npix--;
+	}
+
+	for (n = npix >> 3; n; n--) {
+		memcpy(d,    &lut->pair[src[0]], 4);
+		memcpy(d+4,  &lut->pair[src[1]], 4);
+		memcpy(d+8,  &lut->pair[src[2]], 4);
+		memcpy(d+12, &lut->pair[src[3]], 4);
+		src += 4;
+		d   += 16;
+	}
+	for (n = (npix & 7) >> 1; n; n--) {
+		memcpy(d, &lut->pair[*src++], 4);
+		d += 4;
+	}
+	if (npix & 1) {
+		c = lut->pal[*src >> 4];
+		*d++ = c[0]; *d++ = c[1];
+	}
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*!
+    Flush Window to the Panel.
+	Lines are expanded into ping-pong chunk buffer and fed to wr_block,
+	chunks are kept as multiple of 4 pixels for 32bit bus loops.
+	RGB666 switches the interface format by PixFmt_begin().
+	Returns 0 on success,-1 when the driver lacks RGB666.
+*/
+/**************************************************************************/
+int IdxFB_flush(uint16_t x, uint16_t width, uint16_t y, uint16_t height)
+{
+	const uint8_t* fb = IdxFB.buf[(IdxFB.buf[1] != NULL) ? (IdxFB.draw ^ 1) : 0];
+	uint32_t bpp_out = (IdxFB.lut.out == IDXFB_OUT_RGB666) ? 3 : 2;
+	uint32_t w = (uint32_t)width - x + 1;
+	uint32_t fill = 0;						/* bytes in current line buffer */
+	uint32_t k,send,i;
+	uint8_t  sel = 0;
+	uint8_t* lb = (uint8_t*)idxfb_line[0];
+	uint16_t j;
+
+	if (IdxFB.lut.out == IDXFB_OUT_RGB666) {
+		if (PixFmt_begin(&IdxFB.ops, PIXFMT_RGB666, x, width, y, height)) return -1;
+	}
+	else {
+		IdxFB.ops.rect(x, width, y, height);
+	}
+
+	for (j = y; j <= height; j++) {
+		const uint8_t* src = fb + (uint32_t)j * IdxFB.stride;
+		uint32_t done = 0;
+
+		while (done < w) {
+			k = IDXFB_CHUNK - fill / bpp_out;
+			if (k > w - done) k = w - done;
+
+			if (IdxFB.bpp == 8)	fill += IdxFB_expand8(&IdxFB.lut, lb + fill, src + x + done, k);
+			else				fill += IdxFB_expand4(&IdxFB.lut, lb + fill, src, x + done, k);
+			done += k;
+
+			if (fill >= IDXFB_CHUNK * bpp_out) {
+				IdxFB.ops.wr_block(lb, fill);
+				sel ^= 1;
+				lb   = (uint8_t*)idxfb_line[sel];
+				fill = 0;
+			}
+		}
+
+		/* send whole 4-pixel groups,carry remainder to next line */
+		send = (fill / bpp_out) & ~3u;
+		if (send) {
+			send *= bpp_out;
+			IdxFB.ops.wr_block(lb, send);
+			sel ^= 1;
+			for (i = send; i < fill; i++) ((uint8_t*)idxfb_line[sel])[i - send] = lb[i];
+			lb    = (uint8_t*)idxfb_line[sel];
+			fill -= send;
+		}
+	}
+
+	/* last odd pixels */
+	if (IdxFB.lut.out == IDXFB_OUT_RGB666) {
+		PixFmt_write(lb, fill);
+		PixFmt_end();
+		return 0;
+	}
+	for (i = 0; i + 1 < fill; i += 2) {
+		IdxFB.ops.wr_gram((uint16_t)(lb[i] << 8 | lb[i+1]));
+	}
+
+	return 0;
+}
+
+/**************************************************************************/
+/*!
+    Swap Drawing / Flushing Buffer.
+*/
+/**************************************************************************/
+void IdxFB_swap(void)
+{
+	if (IdxFB.buf[1] != NULL) IdxFB.draw ^= 1;
+}
+
+/**************************************************************************/
+/*!
+    Get Drawing Buffer.
+*/
+/**************************************************************************/
+uint8_t* IdxFB_draw_buf(void)
+{
+	return IdxFB.buf[IdxFB.draw];
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,83 @@
+/********************************************************************************/
+/*!
+	@file			display_indexfb.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Indexed-Colour(4/8bpp) Framebuffer with Palette Expansion	@n
+					in the Flush Path.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Sent RGB666 through PixFmt_begin(),rebuilt palette on output change.
+		2026.10.19	V3.00	Split expansion tables into IdxFB_Lut_t for other indexed sources.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_INDEXFB_H
+#define DISPLAY_INDEXFB_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+#include "display_pixfmt.h"
+
+/* Pixels expanded per wr_block,MUST be multiple of 8 */
+#ifndef IDXFB_CHUNK
+ #define IDXFB_CHUNK		480
+#endif
+
+/* Output Pixel Format */
+#define IDXFB_OUT_RGB565	0			/* 2bytes/pixel */
+#define IDXFB_OUT_RGB666	1			/* 3bytes/pixel,needs ops.set_fmt(DISPOPS_DRIVER_FMT) */
+/* Drivers converting RGB565 to RGB666 in wr_block(e.g. ILI9481 serial) use RGB565 */
+
+/* Expansion Tables,also used by other indexed sources(e.g. display_asset) */
+typedef struct {
+	uint8_t		pal[256][3];		/* palette in bus byte order */
+	uint32_t	pair[256];			/* 4bpp:one index byte -> two RGB565 pixels */
+	uint8_t		out;				/* IDXFB_OUT_xxx */
+} IdxFB_Lut_t;
+
+/* Indexed Framebuffer State */
+typedef struct {
+	uint8_t*	buf[2];				/* [0]/[1] index buffer,buf[1]=NULL on single buffer */
+	uint16_t	width;
+	uint16_t	height;
+	uint16_t	stride;				/* bytes per line */
+	uint8_t		bpp;				/* 4 or 8 */
+	uint8_t		draw;				/* index of drawing buffer */
+	uint16_t	rgb[256];			/* palette as given(RGB565) */
+	IdxFB_Lut_t	lut;
+	DispOps_t	ops;
+} IdxFB_t;
+
+extern IdxFB_t IdxFB;
+
+/* Indexed Framebuffer Functions Prototype */
+extern void IdxFB_init(uint8_t* buf0, uint8_t* buf1, uint16_t width, uint16_t height, uint8_t bpp, const DispOps_t* ops);
+extern void IdxFB_set_output(uint8_t out);
+extern void IdxFB_set_palette(const uint16_t* rgb565, uint16_t first, uint16_t num);
+extern void IdxFB_pset(uint16_t x, uint16_t y, uint8_t idx);
+extern void IdxFB_fill(uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint8_t idx);
+extern int IdxFB_flush(uint16_t x, uint16_t width, uint16_t y, uint16_t height);
+extern void IdxFB_swap(void);
+extern uint8_t* IdxFB_draw_buf(void);
+extern void IdxFB_lut_build(IdxFB_Lut_t* lut, const uint16_t* rgb565, uint16_t first, uint16_t num, uint8_t bpp);
+extern uint32_t IdxFB_expand8(const IdxFB_Lut_t* lut, uint8_t* dst, const uint8_t* src, uint32_t npix);
+extern uint32_t IdxFB_expand4(const IdxFB_Lut_t* lut, uint8_t* dst, const uint8_t* src, uint32_t x, uint32_t npix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_INDEXFB_H */
@@ -0,0 +1,271 @@
+/********************************************************************************/
+/*!
+	@file			display_list.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Display-List Recorder and Backend-Neutral Executor.		@n
+					One UI frame is recorded then submitted at once.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed window reset on continued data.
+		2026.10.19	V3.00	Emit by shared DispOps_emit.
+		2026.10.19	V4.00	Hold bus over submit by ops begin/end.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_list.h"
+/* check header file version for fool proof */
+#if DISPLAY_LIST_H != 0x0400
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t dl_line[DL_LINE_PIXELS*2];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Reserve Words in the List.
+*/
+/**************************************************************************/
+static uint32_t* DispList_alloc(DispList_t* dl, uint32_t words)
+{
+	uint32_t* p;
+
+	if (dl->overflow || (dl->len + words > dl->size)) {
+		dl->overflow = 1;
+		return NULL;
+	}
+	p = &dl->buf[dl->len];
+	dl->len += words;
+
+	return p;
+}
+
+/**************************************************************************/
+/*!
+    Start Recording.
+*/
+/**************************************************************************/
+void DispList_begin(DispList_t* dl, uint32_t* buf, uint32_t words)
+{
+	dl->buf		 = buf;
+	dl->size	 = words;
+	dl->len		 = 0;
+	dl->overflow = 0;
+}
+
+/**************************************************************************/
+/*!
+    Record Commands.
+	Same manner as Display_rect_if,width/height are END point.
+*/
+/**************************************************************************/
+void DispList_window(DispList_t* dl, uint16_t x, uint16_t width, uint16_t y, uint16_t height)
+{
+	uint32_t* p = DispList_alloc(dl, 3);
+
+	if (!p) return;
+	p[0] = DL_OP_WINDOW;
+	p[1] = (uint32_t)x | ((uint32_t)width  << 16);
+	p[2] = (uint32_t)y | ((uint32_t)height << 16);
+}
+
+void DispList_fill(DispList_t* dl, uint16_t colour, uint32_t pixels)
+{
+	uint32_t* p = DispList_alloc(dl, 3);
+
+	if (!p) return;
+	p[0] = DL_OP_FILL;
+	p[1] = colour;
+	p[2] = pixels;
+}
+
+void DispList_fill_rect(DispList_t* dl, uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint16_t colour)
+{
+	DispList_window(dl, x, width, y, height);
+	DispList_fill(dl, colour, (uint32_t)(width - x + 1) * (height - y + 1));
+}
+
+void DispList_blit(DispList_t* dl, const uint8_t* src, uint32_t bytes)
+{
+	uint32_t* p = DispList_alloc(dl, 2 + DL_PTR_WORDS);
+
+	if (!p) return;
+	p[0] = DL_OP_BLIT;
+	memcpy(&p[1], &src, sizeof(src));
+	p[1 + DL_PTR_WORDS] = bytes;
+}
+
+void DispList_glyphs(DispList_t* dl, uint16_t x, uint16_t y, uint16_t height, uint16_t fg, uint16_t bg, const DL_Glyph_t* glyphs, uint16_t count)
+{
+	uint32_t* p = DispList_alloc(dl, 4 + (uint32_t)count * (1 + DL_PTR_WORDS));
+	uint16_t  i;
+
+	if (!p) return;
+	p[0] = DL_OP_GLYPHS | ((uint32_t)count << 8);
+	p[1] = (uint32_t)x | ((uint32_t)y  << 16);
+	p[2] = (uint32_t)height | ((uint32_t)fg << 16);
+	p[3] = bg;
+	p += 4;
+
+	for (i = 0; i < count; i++) {
+		memcpy(p, &glyphs[i].bitmap, sizeof(glyphs[i].bitmap));
+		p[DL_PTR_WORDS] = glyphs[i].width;
+		p += 1 + DL_PTR_WORDS;
+	}
+}
+
+void DispList_scroll(DispList_t* dl, uint32_t line)
+{
+	uint32_t* p = DispList_alloc(dl, 2);
+
+	if (!p) return;
+	p[0] = DL_OP_SCROLL;
+	p[1] = line;
+}
+
+/**************************************************************************/
+/*!
+    Replay Display List.
+	Window is set lazily just before pixel data,consecutive window commands
+	collapse and a window equal to the current one is skipped when cursor
+	has wrapped to its start point.
+	Data without a new window continues from the current cursor.
+	Bus is held(CS low) over the whole list if ops has begin/end.
+*/
+/**************************************************************************/
+void DispList_submit(const DispList_t* dl, const DispOps_t* ops)
+{
+	const uint32_t* p   = dl->buf;
+	const uint32_t* end = dl->buf + dl->len;
+	uint32_t win[2]  = { 0, 0 };			/* requested window */
+	uint32_t cur[2]  = { 0xFFFFFFFF, 0 };	/* window on the controller */
+	uint32_t area    = 0;
+	uint32_t written = 0;					/* pixels since last rect */
+	uint8_t  pending = 0;					/* window command not yet applied */
+	int32_t  linecol = -1;					/* colour held in dl_line */
+	uint32_t n,k,i,j;
+
+	if (ops->begin) ops->begin();
+
+	while (p < end) {
+		uint8_t op = (uint8_t)p[0];
+
+		if (op == DL_OP_WINDOW) {
+			win[0]  = p[1];
+			win[1]  = p[2];
+			pending = 1;
+			p += 3;
+			continue;
+		}
+		if (op == DL_OP_SCROLL) {
+			if (ops->scroll) ops->scroll(p[1]);
+			p += 2;
+			continue;
+		}
+
+		if (op == DL_OP_GLYPHS) {
+			uint32_t x = p[1] & 0xFFFF, y = p[1] >> 16, h = p[2] & 0xFFFF, w = 0;
+			for (i = 0, n = p[0] >> 8; i < n; i++) w += p[4 + i*(1 + DL_PTR_WORDS) + DL_PTR_WORDS];
+			if (!w || !h) {					/* nothing to draw */
+				p += 4 + (p[0] >> 8) * (1 + DL_PTR_WORDS);
+				continue;
+			}
+			win[0]  = x | ((x + w - 1) << 16);
+			win[1]  = y | ((y + h - 1) << 16);
+			pending = 1;
+		}
+
+		/* Set window only if really needed */
+		if ((win[0] != cur[0]) || (win[1] != cur[1]) || (pending && area && (written % area))) {
+			ops->rect(win[0] & 0xFFFF, win[0] >> 16, win[1] & 0xFFFF, win[1] >> 16);
+			cur[0]  = win[0];
+			cur[1]  = win[1];
+			area    = ((win[0] >> 16) - (win[0] & 0xFFFF) + 1) * ((win[1] >> 16) - (win[1] & 0xFFFF) + 1);
+			written = 0;
+		}
+		pending = 0;
+
+		switch (op) {
+		case DL_OP_FILL:
+			if (linecol != (int32_t)p[1]) {
+				for (i = 0; i < sizeof(dl_line); i += 2) {
+					dl_line[i]   = (uint8_t)(p[1] >> 8);
+					dl_line[i+1] = (uint8_t)p[1];
+				}
+				linecol = (int32_t)p[1];
+			}
+			for (n = p[2]; n; n -= k) {
+				k = (n > DL_LINE_PIXELS) ? DL_LINE_PIXELS : n;
+				DispOps_emit(ops, dl_line, k * 2);
+			}
+			written += p[2];
+			p += 3;
+			break;
+
+		case DL_OP_BLIT:
+			{
+				const uint8_t* src;
+				memcpy(&src, &p[1], sizeof(src));
+				DispOps_emit(ops, src, p[1 + DL_PTR_WORDS]);
+				written += p[1 + DL_PTR_WORDS] / 2;
+			}
+			p += 2 + DL_PTR_WORDS;
+			break;
+
+		case DL_OP_GLYPHS:
+			{
+				uint32_t cnt = p[0] >> 8, h = p[2] & 0xFFFF, fg = p[2] >> 16, bg = p[3];
+				const uint32_t* g0 = p + 4;
+				uint32_t fill = 0;
+
+				linecol = -1;
+				for (j = 0; j < h; j++) {
+					const uint32_t* g = g0;
+					for (i = 0; i < cnt; i++, g += 1 + DL_PTR_WORDS) {
+						const uint8_t* row;
+						uint32_t w = g[DL_PTR_WORDS], x, c;
+						memcpy(&row, g, sizeof(row));
+						row += j * ((w + 7) / 8);
+						for (x = 0; x < w; x++) {
+							c = (row[x >> 3] & (0x80 >> (x & 7))) ? fg : bg;
+							dl_line[fill++] = (uint8_t)(c >> 8);
+							dl_line[fill++] = (uint8_t)c;
+							if (fill == sizeof(dl_line)) {
+								ops->wr_block(dl_line, fill);
+								fill = 0;
+							}
+						}
+					}
+				}
+				DispOps_emit(ops, dl_line, fill);
+				written += area;
+				p += 4 + cnt * (1 + DL_PTR_WORDS);
+			}
+			break;
+
+		default:	/* broken list,stop here */
+			p = end;
+			break;
+		}
+	}
+
+	if (ops->end) ops->end();
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
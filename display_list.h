@@ -0,0 +1,79 @@
+/********************************************************************************/
+/*!
+	@file			display_list.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Display-List Recorder and Backend-Neutral Executor.		@n
+					One UI frame is recorded then submitted at once.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed window reset on continued data.
+		2026.10.19	V3.00	Emit by shared DispOps_emit.
+		2026.10.19	V4.00	Hold bus over submit by ops begin/end.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H 0x0400
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Executor line buffer(pixels),MUST be even */
+#ifndef DL_LINE_PIXELS
+ #define DL_LINE_PIXELS		320
+#endif
+
+/* Opcodes */
+#define DL_OP_WINDOW		0x01		/* [x|width<<16] [y|height<<16] */
+#define DL_OP_FILL			0x02		/* [colour] [pixels] */
+#define DL_OP_BLIT			0x03		/* [ptr] [bytes] */
+#define DL_OP_GLYPHS		0x04		/* [x|y<<16] [height|fg<<16] [bg] + count*([ptr] [width]) */
+#define DL_OP_SCROLL		0x05		/* [line] */
+
+/* Words to hold a pointer */
+#define DL_PTR_WORDS		((sizeof(void*)+3)/4)
+
+/* Glyph of 1bpp bitmap,MSB first,(width+7)/8 bytes per row */
+typedef struct {
+	const uint8_t*	bitmap;
+	uint16_t		width;
+} DL_Glyph_t;
+
+/* Display List */
+typedef struct {
+	uint32_t*	buf;
+	uint32_t	size;				/* words */
+	uint32_t	len;				/* words used */
+	uint8_t		overflow;			/* set when a command did not fit */
+} DispList_t;
+
+/* Recorder Functions Prototype */
+extern void DispList_begin(DispList_t* dl, uint32_t* buf, uint32_t words);
+extern void DispList_window(DispList_t* dl, uint16_t x, uint16_t width, uint16_t y, uint16_t height);
+extern void DispList_fill(DispList_t* dl, uint16_t colour, uint32_t pixels);
+extern void DispList_fill_rect(DispList_t* dl, uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint16_t colour);
+extern void DispList_blit(DispList_t* dl, const uint8_t* p, uint32_t bytes);
+extern void DispList_glyphs(DispList_t* dl, uint16_t x, uint16_t y, uint16_t height, uint16_t fg, uint16_t bg, const DL_Glyph_t* glyphs, uint16_t count);
+extern void DispList_scroll(DispList_t* dl, uint32_t line);
+
+/* Executor Functions Prototype */
+extern void DispList_submit(const DispList_t* dl, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_LIST_H */
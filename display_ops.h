@@ -0,0 +1,62 @@
+/********************************************************************************/
+/*!
+	@file			display_ops.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        5.00
+    @date           2026.10.19
+	@brief          Driver Entry Points for Backend-Neutral Display Modules.	@n
+					Bind with DISPOPS_DRIVER on target,or host stand-in.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added optional scroll entry.
+		2026.10.19	V3.00	Added optional pixel format entries.
+		2026.10.19	V4.00	Added shared block/odd pixel emit.
+		2026.10.19	V5.00	Added optional bus hold entries.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_OPS_H
+#define DISPLAY_OPS_H 0x0500
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Driver Entry Points */
+typedef struct {
+	void (*rect)(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
+	void (*wr_gram)(uint16_t gram);
+	void (*wr_block)(uint8_t* blockdata,unsigned int datacount);
+	void (*scroll)(uint32_t line);		/* optional,NULL if not supported */
+	int  (*set_fmt)(uint8_t fmt);		/* optional,interface pixel format(PIXFMT_xx),0 = set */
+	void (*wr_byte)(uint8_t dat);		/* needed with set_fmt,one data byte */
+	void (*begin)(void);				/* optional,hold bus(CS) over a batch of writes */
+	void (*end)(void);					/* optional,release bus held by begin */
+} DispOps_t;
+
+/* Bind to the driver selected in MAKEFILE (include its header before use) */
+#define DISPOPS_DRIVER		{ Display_rect_if, Display_wr_dat_if, Display_wr_block_if, NULL, NULL, NULL, NULL, NULL }
+/* Same,for drivers having Display_set_pixfmt_if */
+#define DISPOPS_DRIVER_FMT	{ Display_rect_if, Display_wr_dat_if, Display_wr_block_if, NULL, Display_set_pixfmt_if, Display_wr_byte_if, NULL, NULL }
+/* Same,for drivers having Display_begin_if/Display_end_if */
+#define DISPOPS_DRIVER_HOLD	{ Display_rect_if, Display_wr_dat_if, Display_wr_block_if, NULL, NULL, NULL, Display_begin_if, Display_end_if }
+
+/* Send RGB565 bytes(MSB first),32bit loop part by wr_block and odd pixel by wr_gram */
+static inline void DispOps_emit(const DispOps_t* ops, const uint8_t* p, uint32_t bytes)
+{
+	if (bytes & ~3u)	ops->wr_block((uint8_t*)p, bytes & ~3u);
+	if (bytes & 2)		ops->wr_gram((uint16_t)(p[(bytes & ~3u)] << 8 | p[(bytes & ~3u) + 1]));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_OPS_H */
@@ -0,0 +1,228 @@
+/********************************************************************************/
+/*!
+	@file			display_pixfmt.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Reduced Colour-Depth Block Converters.						@n
+					RGB565 -> RGB444(2pixels in 3bytes) / RGB332 / RGB666.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added RGB666.
+		2026.10.19	V3.00	Fixed RGB666 blue LSB.
+		2026.10.19	V4.00	Added formatted blit on DispOps_t.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_pixfmt.h"
+/* check header file version for fool proof */
+#if DISPLAY_PIXFMT_H != 0x0400
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+static const DispOps_t* pixfmt_ops;
+static uint8_t  pixfmt_fmt;
+static uint8_t  pixfmt_tail[4];				/* bytes short of wr_block unit */
+static uint32_t pixfmt_keep;
+static uint8_t  pixfmt_buf[PIXFMT_BYTES(PIXFMT_RGB666,PIXFMT_CHUNK)];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*! 
+    RGB565 to RGB444.
+	Two pixels packed into 3bytes: R1G1 B1R2 G2B2.
+	Odd last pixel is sent as R G B 0.
+*/
+/**************************************************************************/
+uint32_t PixFmt_565to444(uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	uint8_t* d = dst;
+	uint32_t a,b;
+
+	for (; npix >= 2; npix -= 2, src += 4) {
+		a = (uint32_t)src[0]<<8 | src[1];
+		b = (uint32_t)src[2]<<8 | src[3];
+
+		/* R[15:12] G[10:7] B[4:1] */
+		*d++ = (uint8_t)(((a >> 8) & 0xF0) | ((a >> 7) & 0x0F));
+		*d++ = (uint8_t)(((a << 3) & 0xF0) | ((b >> 12) & 0x0F));
+		*d++ = (uint8_t)(((b >> 3) & 0xF0) | ((b >> 1) & 0x0F));
+	}
+
+	if (npix) {
+		a = (uint32_t)src[0]<<8 | src[1];
+		*d++ = (uint8_t)(((a >> 8) & 0xF0) | ((a >> 7) & 0x0F));
+		*d++ = (uint8_t)((a << 3) & 0xF0);
+	}
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*! 
+    RGB565 to RGB666(3bytes,MSB aligned).
+*/
+/**************************************************************************/
+uint32_t PixFmt_565to666(uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	uint8_t* d = dst;
+	uint32_t a;
+
+	for (; npix; npix--, src += 2) {
+		a = (uint32_t)src[0]<<8 | src[1];
+		*d++ = (uint8_t)(((a >> 8) & 0xF8) | ((a >> 13) & 0x04));	/* R5 -> R6 */
+		*d++ = (uint8_t)((a >> 3) & 0xFC);
+		*d++ = (uint8_t)(((a << 3) & 0xF8) | ((a >> 2) & 0x04));	/* B5 -> B6 */
+	}
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*! 
+    RGB565 to RGB332.
+*/
+/**************************************************************************/
+uint32_t PixFmt_565to332(uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	uint32_t n = npix;
+
+	/* R[15:13] G[10:8] B[4:3] */
+	while (n--) {
+		*dst++ = (uint8_t)((src[0] & 0xE0) | ((src[0] << 2) & 0x1C) | ((src[1] >> 3) & 0x03));
+		src += 2;
+	}
+
+	return npix;
+}
+
+/**************************************************************************/
+/*! 
+    Convert by Pixel Format.
+*/
+/**************************************************************************/
+uint32_t PixFmt_convert(uint8_t fmt, uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	switch (fmt) {
+	case PIXFMT_RGB444:
+		return PixFmt_565to444(dst, src, npix);
+	case PIXFMT_RGB332:
+		return PixFmt_565to332(dst, src, npix);
+	case PIXFMT_RGB666:
+		return PixFmt_565to666(dst, src, npix);
+	default:
+		memcpy(dst, src, npix * 2);
+		return npix * 2;
+	}
+}
+
+/**************************************************************************/
+/*! 
+    Start Writing Window in Given Pixel Format.
+	Interface pixel format is set by ops->set_fmt,RGB565 needs none.
+	Returns 0 on success,-1 when the driver lacks fmt(nothing is sent).
+*/
+/**************************************************************************/
+int PixFmt_begin(const DispOps_t* ops, uint8_t fmt, uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	if (fmt != PIXFMT_RGB565) {
+		if (!ops->set_fmt || !ops->wr_byte || ops->set_fmt(fmt)) return -1;
+	}
+
+	pixfmt_ops	= ops;
+	pixfmt_fmt	= fmt;
+	pixfmt_keep = 0;
+	ops->rect(x, width, y, height);
+
+	return 0;
+}
+
+/**************************************************************************/
+/*! 
+    Write Bytes already in the Format of PixFmt_begin().
+	Sent by wr_block in multiple of 4 bytes,rest is carried to next call.
+*/
+/**************************************************************************/
+void PixFmt_write(const uint8_t* p, uint32_t bytes)
+{
+	uint32_t n;
+
+	while (pixfmt_keep && bytes) {
+		pixfmt_tail[pixfmt_keep++] = *p++;
+		bytes--;
+		if (pixfmt_keep == 4) {
+			pixfmt_ops->wr_block(pixfmt_tail, 4);
+			pixfmt_keep = 0;
+		}
+	}
+
+	n = bytes & ~3u;
+	if (n) pixfmt_ops->wr_block((uint8_t*)p, n);
+
+	for (; n < bytes; n++) pixfmt_tail[pixfmt_keep++] = p[n];
+}
+
+/**************************************************************************/
+/*! 
+    Send Carried Bytes and Restore RGB565 Interface Format.
+*/
+/**************************************************************************/
+void PixFmt_end(void)
+{
+	uint32_t i;
+
+	if (pixfmt_fmt == PIXFMT_RGB565) {
+		if (pixfmt_keep >= 2) pixfmt_ops->wr_gram((uint16_t)(pixfmt_tail[0] << 8 | pixfmt_tail[1]));
+	}
+	else {
+		for (i = 0; i < pixfmt_keep; i++) pixfmt_ops->wr_byte(pixfmt_tail[i]);
+		pixfmt_ops->set_fmt(PIXFMT_RGB565);
+	}
+	pixfmt_keep = 0;
+}
+
+/**************************************************************************/
+/*! 
+    Write RGB565 Block Data in Reduced Colour Depth.
+	Converted on the fly,falls back to RGB565 when the driver lacks fmt.
+	Returns 0 when sent in fmt,-1 when sent in RGB565.
+*/
+/**************************************************************************/
+int PixFmt_blit(const DispOps_t* ops, uint32_t x, uint32_t width, uint32_t y, uint32_t height, const uint8_t* p, uint32_t cnt, uint8_t fmt)
+{
+	uint32_t n = cnt / 2;
+	uint32_t k;
+
+	if ((fmt == PIXFMT_RGB565) || PixFmt_begin(ops, fmt, x, width, y, height)) {
+		PixFmt_begin(ops, PIXFMT_RGB565, x, width, y, height);
+		PixFmt_write(p, n * 2);
+		PixFmt_end();
+		return (fmt == PIXFMT_RGB565) ? 0 : -1;
+	}
+
+	while (n) {
+		k = (n > PIXFMT_CHUNK) ? PIXFMT_CHUNK : n;
+		PixFmt_write(pixfmt_buf, PixFmt_convert(fmt, pixfmt_buf, p, k));
+		p += k * 2;
+		n -= k;
+	}
+	PixFmt_end();
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
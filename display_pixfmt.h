@@ -0,0 +1,68 @@
+/********************************************************************************/
+/*!
+	@file			display_pixfmt.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        4.00
+    @date           2026.10.19
+	@brief          Reduced Colour-Depth Block Converters.						@n
+					RGB565 -> RGB444(2pixels in 3bytes) / RGB332 / RGB666.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added RGB666.
+		2026.10.19	V3.00	Fixed RGB666 blue LSB.
+		2026.10.19	V4.00	Added formatted blit on DispOps_t.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_PIXFMT_H
+#define DISPLAY_PIXFMT_H 0x0400
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Pixel Format for blit */
+#define PIXFMT_RGB565		0			/* 16bit/pixel (default) */
+#define PIXFMT_RGB444		1			/* 12bit/pixel,2pixels in 3bytes */
+#define PIXFMT_RGB332		2			/* 8bit/pixel */
+#define PIXFMT_RGB666		3			/* 18bit/pixel,3bytes MSB aligned */
+
+/* Pixels per converted chunk,MUST be multiple of 8 */
+#ifndef PIXFMT_CHUNK
+ #define PIXFMT_CHUNK		64
+#endif
+
+/* Bytes on the bus for npix pixels */
+#define PIXFMT_BYTES(fmt,npix)	(((fmt) == PIXFMT_RGB444) ? (((npix)*3+1)/2) : \
+								 ((fmt) == PIXFMT_RGB332) ? (npix) : \
+								 ((fmt) == PIXFMT_RGB666) ? ((npix)*3) : ((npix)*2))
+
+/* Converter Functions Prototype */
+/* src is RGB565 MSB first (same as wr_block),returns bytes written to dst */
+extern uint32_t PixFmt_565to444(uint8_t* dst, const uint8_t* src, uint32_t npix);
+extern uint32_t PixFmt_565to666(uint8_t* dst, const uint8_t* src, uint32_t npix);
+extern uint32_t PixFmt_565to332(uint8_t* dst, const uint8_t* src, uint32_t npix);
+extern uint32_t PixFmt_convert(uint8_t fmt, uint8_t* dst, const uint8_t* src, uint32_t npix);
+
+/* Formatted Blit Functions Prototype */
+/* Window is END point manner,ops->set_fmt switches the controller */
+extern int  PixFmt_begin(const DispOps_t* ops, uint8_t fmt, uint32_t x, uint32_t width, uint32_t y, uint32_t height);
+extern void PixFmt_write(const uint8_t* p, uint32_t bytes);
+extern void PixFmt_end(void);
+extern int  PixFmt_blit(const DispOps_t* ops, uint32_t x, uint32_t width, uint32_t y, uint32_t height, const uint8_t* p, uint32_t cnt, uint8_t fmt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_PIXFMT_H */
@@ -0,0 +1,242 @@
+/********************************************************************************/
+/*!
+	@file			display_predict.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Frame-Rate Predictor from Bus Traces and Cost Profiles.	@n
+					Workloads run on the host bus stand-in(display_trace.c).
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed lines wider than DPRED_LINE.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_predict.h"
+/* check header file version for fool proof */
+#if DISPLAY_PREDICT_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+/* Workload line buffer(pixels) */
+#define DPRED_LINE			480
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t dpred_line[DPRED_LINE * 2];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Profile:FSMC/FMC i8080 Bus,write cycle is ADDSET+1 + DATAST+1 HCLK.
+	8bit bus is taken from the trace(two transfers per pixel).
+*/
+/**************************************************************************/
+void DispPredict_fsmc(DispPredict_Profile_t* p, uint32_t hclk_hz, uint32_t addset, uint32_t datast)
+{
+	uint32_t t = (uint32_t)((uint64_t)(addset + 1 + datast + 1) * 1000000000u / hclk_hz);
+
+	memset(p, 0, sizeof(*p));
+	p->name = "FSMC";
+	p->cmd	= t;
+	p->dat	= t;
+	p->rd	= t * 2;
+}
+
+/**************************************************************************/
+/*!
+    Profile:SPI at sck_hz,txn_ns per CS assert,CPU polling gap per byte.
+	dma_setup_ns = 0 means no DMA.
+*/
+/**************************************************************************/
+void DispPredict_spi(DispPredict_Profile_t* p, uint32_t sck_hz, uint32_t txn_ns, uint32_t dma_setup_ns)
+{
+	uint32_t t = (uint32_t)(8000000000ull / sck_hz);
+
+	memset(p, 0, sizeof(*p));
+	p->name		 = "SPI";
+	p->cmd		 = t + 100;
+	p->dat		 = t + 100;
+	p->rd		 = t + 100;
+	p->cs		 = txn_ns;
+	p->pin		 = 50;
+	p->dma_dat	 = t;
+	p->dma_setup = dma_setup_ns;
+	p->dma_min	 = dma_setup_ns ? 16 : 0;
+}
+
+/**************************************************************************/
+/*!
+    Profile:GPIO Bit-Bang(port write + WR pulse per transfer).
+*/
+/**************************************************************************/
+void DispPredict_gpio(DispPredict_Profile_t* p, uint32_t write_ns, uint32_t pin_ns)
+{
+	memset(p, 0, sizeof(*p));
+	p->name = "GPIO";
+	p->cmd	= write_ns;
+	p->dat	= write_ns;
+	p->rd	= write_ns * 2;
+	p->cs	= pin_ns;
+	p->pin	= pin_ns;
+}
+
+/**************************************************************************/
+/*!
+    Cost of Data Run,long runs go by DMA.
+*/
+/**************************************************************************/
+static uint64_t DispPredict_run_cost(const DispPredict_Profile_t* p, uint32_t n)
+{
+	if (p->dma_min && (n >= p->dma_min)) return p->dma_setup + (uint64_t)n * p->dma_dat;
+
+	return (uint64_t)n * p->dat;
+}
+
+/**************************************************************************/
+/*!
+    Cost Trace of frames Frames with Profile.
+	Data after GRAM write(DCS 2Ch/3Ch,index R22h) is pixel time.
+*/
+/**************************************************************************/
+void DispPredict_cost(const DispPredict_Profile_t* p, uint8_t style, const uint8_t* trace, uint32_t len, uint32_t frames, DispPredict_Result_t* r)
+{
+	DispTrace_Rd_t rd;
+	DispTrace_Ev_t ev;
+	uint32_t run = 0;
+	uint8_t  writing = 0;
+	uint8_t  cmd;
+	int more;
+
+	memset(r, 0, sizeof(*r));
+	r->trace_bytes = len;
+	DispTrace_open(&rd, trace, len);
+
+	do {
+		more = DispTrace_next(&rd, &ev);
+
+		if (ev.type == DTRACE_DAT) { run++; continue; }
+		if (run) {
+			if (writing) r->pixel_ns += DispPredict_run_cost(p, run);
+			else		 r->cmd_ns	 += DispPredict_run_cost(p, run);
+			run = 0;
+		}
+
+		switch (ev.type) {
+		case DTRACE_CMD:
+			cmd = (uint8_t)ev.val;
+			writing = (style == DTRACE_DCS) ? ((cmd == 0x2C) || (cmd == 0x3C)) : (cmd == 0x22);
+			r->cmd_ns += p->cmd;
+			break;
+		case DTRACE_PIN:
+			r->cmd_ns += (ev.val == (DTRACE_PIN_CS << 1)) ? p->cs : p->pin;
+			break;
+		case DTRACE_DELAY:
+			r->idle_ns += (uint64_t)ev.val * 1000000u;
+			break;
+		case DTRACE_RD:
+			r->idle_ns += p->rd;
+			break;
+		default:
+			break;
+		}
+	} while (more);
+
+	if (!frames) frames = 1;
+	r->cmd_ns	/= frames;
+	r->pixel_ns /= frames;
+	r->idle_ns	/= frames;
+	r->frame_ns	 = r->cmd_ns + r->pixel_ns + r->idle_ns;
+	r->fps_x100	 = r->frame_ns ? (uint32_t)(100000000000ull / r->frame_ns) : 0;
+}
+
+/**************************************************************************/
+/*!
+    Send Lines of Line Buffer.
+*/
+/**************************************************************************/
+static void DispPredict_lines(const DispOps_t* ops, uint32_t w, uint32_t lines)
+{
+	uint32_t i,n;
+
+	while (lines--) {
+		for (i = 0; i < w; i += n) {
+			n = (w - i < DPRED_LINE) ? w - i : DPRED_LINE;
+			ops->wr_block(dpred_line, n * 2);
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Draw One Frame of Built-in Workload.
+*/
+/**************************************************************************/
+void DispPredict_workload(uint8_t workload, uint32_t frame, uint16_t width, uint16_t height, const DispOps_t* ops)
+{
+	uint32_t i,x,y;
+
+	memset(dpred_line, (int)(frame * 0x21), sizeof(dpred_line));
+
+	switch (workload) {
+	case DPRED_DIRTY_UI:
+		for (i = 0; i < 8; i++) {
+			x = (i & 1) ? width / 2 : 8;
+			y = 8 + (i >> 1) * 24;
+			if ((x + 48 > width) || (y + 16 > height)) continue;
+			ops->rect(x, x + 47, y, y + 15);
+			DispPredict_lines(ops, 48, 16);
+		}
+		break;
+
+	case DPRED_TEXT_SCROLL:
+		if (ops->scroll) {
+			y = (frame * 8) % height;
+			ops->scroll(y);
+			ops->rect(0, width - 1, y, y + 7);
+			DispPredict_lines(ops, width, 8);
+			break;
+		}
+		/* no hardware scroll,redraw whole text area */
+		/* FALLTHROUGH */
+
+	default:
+		ops->rect(0, width - 1, 0, height - 1);
+		DispPredict_lines(ops, width, height);
+		break;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Record frames of Workload through ops and Predict.
+	ops MUST reach the driver built on the host bus stand-in.
+	Returns 0 on success,-1 if buf is short for the trace.
+*/
+/**************************************************************************/
+int DispPredict_run(const DispPredict_Profile_t* p, uint8_t style, uint8_t workload, uint32_t frames, uint16_t width, uint16_t height, const DispOps_t* ops, uint8_t* buf, uint32_t size, DispPredict_Result_t* r)
+{
+	uint32_t f,len;
+
+	DispTrace_begin(buf, size);
+	for (f = 0; f < frames; f++) DispPredict_workload(workload, f, width, height, ops);
+	len = DispTrace_end();
+	if (!len) return -1;
+
+	DispPredict_cost(p, style, buf, len, frames, r);
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
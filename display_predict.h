@@ -0,0 +1,74 @@
+/********************************************************************************/
+/*!
+	@file			display_predict.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Frame-Rate Predictor from Bus Traces and Cost Profiles.	@n
+					Workloads run on the host bus stand-in(display_trace.c).
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Fixed lines wider than DPRED_LINE.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_PREDICT_H
+#define DISPLAY_PREDICT_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+#include "display_trace.h"
+
+/* Bus Cost Profile,times in nanoseconds per trace event */
+typedef struct {
+	const char*	name;
+	uint32_t	cmd;				/* command transfer */
+	uint32_t	dat;				/* data transfer by CPU */
+	uint32_t	rd;					/* read transfer */
+	uint32_t	cs;					/* CS assert,per-transaction overhead */
+	uint32_t	pin;				/* other pin change(DC,RES,bit-bang SCK/SDI) */
+	uint32_t	dma_dat;			/* data transfer by DMA */
+	uint32_t	dma_setup;			/* DMA start latency */
+	uint32_t	dma_min;			/* shortest data run sent by DMA,0 = no DMA */
+} DispPredict_Profile_t;
+
+/* Prediction,per frame average */
+typedef struct {
+	uint64_t	cmd_ns;				/* commands,parameters,pins */
+	uint64_t	pixel_ns;			/* GRAM data */
+	uint64_t	idle_ns;			/* delays and reads */
+	uint64_t	frame_ns;
+	uint32_t	fps_x100;
+	uint32_t	trace_bytes;
+} DispPredict_Result_t;
+
+/* Built-in Workloads */
+#define DPRED_FULL_FRAME	0			/* whole panel by wr_block */
+#define DPRED_DIRTY_UI		1			/* 8 widgets of 48x16 */
+#define DPRED_TEXT_SCROLL	2			/* scroll 8 lines + one text row */
+#define DPRED_WORKLOADS		3
+
+/* Predictor Functions Prototype */
+extern void DispPredict_fsmc(DispPredict_Profile_t* p, uint32_t hclk_hz, uint32_t addset, uint32_t datast);
+extern void DispPredict_spi(DispPredict_Profile_t* p, uint32_t sck_hz, uint32_t txn_ns, uint32_t dma_setup_ns);
+extern void DispPredict_gpio(DispPredict_Profile_t* p, uint32_t write_ns, uint32_t pin_ns);
+extern void DispPredict_cost(const DispPredict_Profile_t* p, uint8_t style, const uint8_t* trace, uint32_t len, uint32_t frames, DispPredict_Result_t* r);
+extern void DispPredict_workload(uint8_t workload, uint32_t frame, uint16_t width, uint16_t height, const DispOps_t* ops);
+extern int DispPredict_run(const DispPredict_Profile_t* p, uint8_t style, uint8_t workload, uint32_t frames, uint16_t width, uint16_t height, const DispOps_t* ops, uint8_t* buf, uint32_t size, DispPredict_Result_t* r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_PREDICT_H */
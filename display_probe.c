@@ -0,0 +1,198 @@
+/********************************************************************************/
+/*!
+	@file			display_probe.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Per-Call Instrumentation of Driver Entry Points.			@n
+					Counts,bytes,time and latency histograms per operation.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added wr_gram probe,DWT clock on ARMv7-M/7E-M only.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#define DPROBE_IMPL
+#include "display_probe.h"
+/* check header file version for fool proof */
+#if DISPLAY_PROBE_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+#ifdef DPROBE_ENABLE
+
+#ifndef DPROBE_DRIVER_H
+ #error "DPROBE_DRIVER_H MUST name the driver header to wrap!"
+#endif
+#include DPROBE_DRIVER_H
+
+#if defined(DPROBE_CLOCK_DEFAULT) && !defined(DPROBE_CLOCK_DWT)
+ #include <time.h>
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+/* Cortex-M DWT */
+#define DPROBE_DEMCR		(*(volatile uint32_t*)0xE000EDFC)
+#define DPROBE_DWT_CTRL		(*(volatile uint32_t*)0xE0001000)
+#define DPROBE_DWT_CYCCNT	(*(volatile uint32_t*)0xE0001004)
+
+/* Variables -----------------------------------------------------------------*/
+DispProbe_Op_t DispProbe_Op[DPROBE_OPS];
+static uint32_t dprobe_frame_start;
+static uint32_t dprobe_frame_tick;
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const dprobe_name[DPROBE_OPS] = {
+	"init", "rect", "wr_cmd", "wr_dat", "wr_block", "clear", "wr_gram", "frame"
+};
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+#ifdef DPROBE_CLOCK_DEFAULT
+/**************************************************************************/
+/*!
+    Default High-Resolution Clock.
+*/
+/**************************************************************************/
+uint32_t DispProbe_clock(void)
+{
+#if defined(DPROBE_CLOCK_DWT)
+	return DPROBE_DWT_CYCCNT;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+#endif
+}
+#endif
+
+/**************************************************************************/
+/*!
+    Record One Call.
+*/
+/**************************************************************************/
+static inline void DispProbe_record(uint32_t op, uint32_t bytes, uint32_t start)
+{
+	DispProbe_Op_t* p = &DispProbe_Op[op];
+	uint32_t dt = DPROBE_CLOCK() - start;
+	uint32_t v	= dt >> DPROBE_HIST_SHIFT;
+	uint32_t bin = 0;
+
+	while (v && (bin < DPROBE_HIST_BINS - 1)) { v >>= 1; bin++; }
+
+	p->count++;
+	p->bytes += bytes;
+	p->time  += dt;
+	if (dt > p->max) p->max = dt;
+	p->hist[bin]++;
+}
+
+/**************************************************************************/
+/*!
+    Clear Records and Start Clock.
+*/
+/**************************************************************************/
+void DispProbe_reset(void)
+{
+#if defined(DPROBE_CLOCK_DWT)
+	DPROBE_DEMCR	|= (1u << 24);				/* TRCENA */
+	DPROBE_DWT_CTRL |= 1u;						/* CYCCNTENA */
+#endif
+	memset(DispProbe_Op, 0, sizeof(DispProbe_Op));
+	dprobe_frame_start = DPROBE_CLOCK();
+	dprobe_frame_tick  = ticktime;
+}
+
+/**************************************************************************/
+/*!
+    Mark Frame Boundary,bytes of frame record hold ticktime elapsed.
+*/
+/**************************************************************************/
+void DispProbe_frame(void)
+{
+	uint32_t now = DPROBE_CLOCK();
+	uint32_t tick = ticktime;
+
+	DispProbe_record(DPROBE_FRAME, tick - dprobe_frame_tick, dprobe_frame_start);
+	dprobe_frame_start = now;
+	dprobe_frame_tick  = tick;
+}
+
+/**************************************************************************/
+/*!
+    Hand Every Record to out().
+*/
+/**************************************************************************/
+void DispProbe_dump(void (*out)(void* ctx, const char* name, const DispProbe_Op_t* op), void* ctx)
+{
+	uint32_t i;
+
+	for (i = 0; i < DPROBE_OPS; i++) out(ctx, dprobe_name[i], &DispProbe_Op[i]);
+}
+
+/**************************************************************************/
+/*!
+    Wrapped Entry Points.
+*/
+/**************************************************************************/
+void DispProbe_init(void)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_init_if();
+	DispProbe_record(DPROBE_INIT, 0, t);
+}
+
+void DispProbe_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_rect_if(x, width, y, height);
+	DispProbe_record(DPROBE_RECT, 0, t);
+}
+
+void DispProbe_wr_cmd(uint16_t cmd)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_wr_cmd_if(cmd);
+	DispProbe_record(DPROBE_WR_CMD, 0, t);
+}
+
+void DispProbe_wr_dat(uint16_t dat)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_wr_dat_if(dat);
+	DispProbe_record(DPROBE_WR_DAT, 2, t);
+}
+
+void DispProbe_wr_gram(uint16_t gram)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_wr_gram_if(gram);
+	DispProbe_record(DPROBE_WR_GRAM, 2, t);
+}
+
+void DispProbe_wr_block(uint8_t* blockdata,unsigned int datacount)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_wr_block_if(blockdata, datacount);
+	DispProbe_record(DPROBE_WR_BLOCK, datacount, t);
+}
+
+void DispProbe_clear(void)
+{
+	uint32_t t = DPROBE_CLOCK();
+	Display_clear_if();
+	DispProbe_record(DPROBE_CLEAR, 0, t);
+}
+
+#endif /* DPROBE_ENABLE */
+
+
+/* End Of File ---------------------------------------------------------------*/
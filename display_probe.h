@@ -0,0 +1,130 @@
+/********************************************************************************/
+/*!
+	@file			display_probe.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Per-Call Instrumentation of Driver Entry Points.			@n
+					Counts,bytes,time and latency histograms per operation.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added wr_gram probe,DWT clock on ARMv7-M/7E-M only.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_PROBE_H
+#define DISPLAY_PROBE_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Enable in MAKEFILE with driver header to wrap,e.g.
+   -DDPROBE_ENABLE -DDPROBE_DRIVER_H=\"ili934x.h\"
+   Include this after the driver header,Display_xxx_if then go through the probe.
+   Undefined = all probe calls compile to nothing. */
+/* #define DPROBE_ENABLE */
+
+/* Histogram:bin n holds calls of 2^(n-1)..2^n-1 clock units >> DPROBE_HIST_SHIFT */
+#ifndef DPROBE_HIST_BINS
+ #define DPROBE_HIST_BINS	16
+#endif
+#ifndef DPROBE_HIST_SHIFT
+ #define DPROBE_HIST_SHIFT	4
+#endif
+
+/* Operations */
+#define DPROBE_INIT			0
+#define DPROBE_RECT			1
+#define DPROBE_WR_CMD		2
+#define DPROBE_WR_DAT		3
+#define DPROBE_WR_BLOCK		4
+#define DPROBE_CLEAR		5
+#define DPROBE_WR_GRAM		6			/* pixel writes,Display_wr_gram_if */
+#define DPROBE_FRAME		7			/* frame to frame,bytes = ticktime elapsed */
+#define DPROBE_OPS			8
+
+/* Per Operation Record,times are DPROBE_CLOCK() units */
+typedef struct {
+	uint32_t	count;
+	uint32_t	bytes;
+	uint32_t	time;				/* total */
+	uint32_t	max;
+	uint32_t	hist[DPROBE_HIST_BINS];
+} DispProbe_Op_t;
+
+#ifdef DPROBE_ENABLE
+
+/* High-Resolution Clock,default DWT cycle counter on ARMv7-M/7E-M(Cortex-M3/4/7),
+   clock_gettime() nanoseconds on the host.
+   Other cores(e.g. Cortex-M0/M0+ have no CYCCNT) MUST give DPROBE_CLOCK() */
+#ifndef DPROBE_CLOCK
+ #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+  #define DPROBE_CLOCK_DWT
+ #elif defined(__arm__) && !defined(__unix__)
+  #error "No DWT cycle counter on this core,define DPROBE_CLOCK() in MAKEFILE!"
+ #endif
+ #define DPROBE_CLOCK()		DispProbe_clock()
+ #define DPROBE_CLOCK_DEFAULT
+#endif
+extern uint32_t DispProbe_clock(void);
+
+/* Pixel write entry,drivers without Display_wr_gram_if write GRAM by Display_wr_dat_if.
+   Call Display_wr_gram_if for pixels to count them apart from parameter writes. */
+#ifndef Display_wr_gram_if
+ #define Display_wr_gram_if		Display_wr_dat_if
+#endif
+
+extern DispProbe_Op_t DispProbe_Op[DPROBE_OPS];
+extern volatile uint32_t ticktime;
+
+/* Probe Functions Prototype */
+extern void DispProbe_reset(void);
+extern void DispProbe_frame(void);
+extern void DispProbe_dump(void (*out)(void* ctx, const char* name, const DispProbe_Op_t* op), void* ctx);
+extern void DispProbe_init(void);
+extern void DispProbe_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
+extern void DispProbe_wr_cmd(uint16_t cmd);
+extern void DispProbe_wr_dat(uint16_t dat);
+extern void DispProbe_wr_gram(uint16_t gram);
+extern void DispProbe_wr_block(uint8_t* blockdata,unsigned int datacount);
+extern void DispProbe_clear(void);
+
+/* Route Application Layer Macros through the probe */
+#ifndef DPROBE_IMPL
+ #undef  Display_init_if
+ #undef  Display_rect_if
+ #undef  Display_wr_cmd_if
+ #undef  Display_wr_dat_if
+ #undef  Display_wr_gram_if
+ #undef  Display_wr_block_if
+ #undef  Display_clear_if
+ #define Display_init_if		DispProbe_init
+ #define Display_rect_if		DispProbe_rect
+ #define Display_wr_cmd_if		DispProbe_wr_cmd
+ #define Display_wr_dat_if		DispProbe_wr_dat
+ #define Display_wr_gram_if		DispProbe_wr_gram
+ #define Display_wr_block_if	DispProbe_wr_block
+ #define Display_clear_if		DispProbe_clear
+#endif
+
+#else
+
+#define DispProbe_reset()			((void)0)
+#define DispProbe_frame()			((void)0)
+#define DispProbe_dump(out,ctx)		((void)0)
+
+#endif /* DPROBE_ENABLE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_PROBE_H */
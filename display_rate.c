@@ -0,0 +1,121 @@
+/********************************************************************************/
+/*!
+	@file			display_rate.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Content-Adaptive Panel Frame Rate Control.					@n
+					Panel refresh follows flush rate,changed at TE if used.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Noted drivers with frame rate levels.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_rate.h"
+/* check header file version for fool proof */
+#if DISPLAY_RATE_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+DispRate_Stat_t DispRate_Stat;
+static const DispRate_Cfg_t* drate_cfg;
+static uint32_t drate_start;				/* window start(ms) */
+static uint32_t drate_flushes;
+static uint32_t drate_hold;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Start Rate Control at Given Level(written to the panel now).
+	now is any millisecond counter,e.g. ticktime.
+*/
+/**************************************************************************/
+void DispRate_init(const DispRate_Cfg_t* cfg, uint8_t level, uint32_t now)
+{
+	drate_cfg	  = cfg;
+	drate_start	  = now;
+	drate_flushes = 0;
+	drate_hold	  = 0;
+
+	memset(&DispRate_Stat, 0, sizeof(DispRate_Stat));
+	if (level >= cfg->levels) level = cfg->levels - 1;
+	cfg->set(level);
+	DispRate_Stat.level = DispRate_Stat.want = level;
+	DispRate_Stat.hz	= cfg->hz[level];
+}
+
+/**************************************************************************/
+/*!
+    Count One Flush(frame sent to the panel).
+*/
+/**************************************************************************/
+void DispRate_flush(void)
+{
+	drate_flushes++;
+}
+
+/**************************************************************************/
+/*!
+    Decide and Apply Frame Rate.
+	Call from main loop,boundary = 1 right after TE edge.
+	Raise at once,lower after DRATE_HOLD windows of less demand.
+	With cfg->te,the panel is written only when boundary is set.
+*/
+/**************************************************************************/
+void DispRate_update(uint32_t now, uint8_t boundary)
+{
+	const DispRate_Cfg_t* cfg = drate_cfg;
+	uint32_t dt = now - drate_start;
+	uint32_t need;
+	uint8_t  target;
+
+	if (!cfg) return;
+
+	if (dt >= DRATE_WINDOW_MS) {
+		DispRate_Stat.flush_fps = (uint16_t)((drate_flushes * 1000 + dt / 2) / dt);
+		drate_flushes = 0;
+		drate_start	  = now;
+
+		need = (uint32_t)DispRate_Stat.flush_fps * DRATE_RATIO;
+		for (target = 0; (target + 1 < cfg->levels) && (cfg->hz[target] < need); target++);
+
+		if (target > DispRate_Stat.want) {
+			DispRate_Stat.want = target;
+			drate_hold = 0;
+		}
+		else if (target < DispRate_Stat.want) {
+			if (++drate_hold >= DRATE_HOLD) {
+				DispRate_Stat.want = target;
+				drate_hold = 0;
+			}
+		}
+		else {
+			drate_hold = 0;
+		}
+	}
+
+	if ((DispRate_Stat.want == DispRate_Stat.level) || (cfg->te && !boundary)) return;
+
+	if (DispRate_Stat.want > DispRate_Stat.level) DispRate_Stat.ups++;
+	else										  DispRate_Stat.downs++;
+	DispRate_Stat.level = DispRate_Stat.want;
+	DispRate_Stat.hz	= cfg->hz[DispRate_Stat.level];
+	cfg->set(DispRate_Stat.level);
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
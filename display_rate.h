@@ -0,0 +1,80 @@
+/********************************************************************************/
+/*!
+	@file			display_rate.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Content-Adaptive Panel Frame Rate Control.					@n
+					Panel refresh follows flush rate,changed at TE if used.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Noted drivers with frame rate levels.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_RATE_H
+#define DISPLAY_RATE_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Measuring window(ms) of flush rate */
+#ifndef DRATE_WINDOW_MS
+ #define DRATE_WINDOW_MS	250
+#endif
+/* Windows of lower demand before stepping down(hysteresis) */
+#ifndef DRATE_HOLD
+ #define DRATE_HOLD			8
+#endif
+/* Panel refresh kept at DRATE_RATIO x flush rate or more */
+#ifndef DRATE_RATIO
+ #define DRATE_RATIO		2
+#endif
+
+/* Driver Frame Rate Levels */
+typedef struct {
+	void			(*set)(uint8_t level);	/* write panel frame rate,0 = slowest */
+	const uint8_t*	hz;						/* refresh per level(Hz),ascending */
+	uint8_t			levels;
+	uint8_t			te;						/* 1:change only at frame boundary */
+} DispRate_Cfg_t;
+
+/* Bind to the driver selected in MAKEFILE (include its header before use).
+   Drivers with frame rate levels:ILI934x,ST7735,ST7789V2 and ILI932x.
+   HX83xx drivers have none.Their refresh is set by oscillator trim
+   (R18h RADJ on HX8340B/HX8347/HX8352,UADJ/CADJ on other HX8347 variants).
+   Each driver sets one trim value with its Hz and the trim to Hz step
+   differs per variant,so a level table would be a guess.
+   Give cfg.set/cfg.hz by hand for a measured panel. */
+#define DISPRATE_DRIVER(te)	{ Display_set_frame_rate_if, Display_frame_rate_hz_if, Display_frame_rates_if, te }
+
+/* Rate Statistics */
+typedef struct {
+	uint8_t		level;				/* on the panel */
+	uint8_t		want;				/* decided,waits for frame boundary if TE */
+	uint8_t		hz;
+	uint16_t	flush_fps;			/* last window */
+	uint32_t	ups;
+	uint32_t	downs;
+} DispRate_Stat_t;
+
+extern DispRate_Stat_t DispRate_Stat;
+
+/* Rate Control Functions Prototype */
+extern void DispRate_init(const DispRate_Cfg_t* cfg, uint8_t level, uint32_t now);
+extern void DispRate_flush(void);
+extern void DispRate_update(uint32_t now, uint8_t boundary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_RATE_H */
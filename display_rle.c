@@ -0,0 +1,206 @@
+/********************************************************************************/
+/*!
+	@file			display_rle.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Run-Length Compressed RGB565 Image Blitter and Encoder.	@n
+					Runs become fills,literals go to wr_block in place.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_rle.h"
+/* check header file version for fool proof */
+#if DISPLAY_RLE_H != 0x0100
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DRLE_BUF_BYTES		(DRLE_BUF_PIXELS*2)
+
+/* Variables -----------------------------------------------------------------*/
+DispRLE_Stat_t DispRLE_Stat;
+static uint8_t  drle_stage[DRLE_BUF_BYTES];		/* short runs and literals */
+static uint8_t  drle_fill[DRLE_BUF_BYTES];		/* one colour replicated */
+static uint32_t drle_sfill;
+static int32_t  drle_fillcol = -1;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Encode RGB565 Pixels(MSB first) to RLE Stream.
+	dst needs npix*2 + 2*(npix/DRLE_MAX_COUNT + 1) bytes at worst.
+	Returns encoded bytes.
+*/
+/**************************************************************************/
+uint32_t DispRLE_encode(uint8_t* dst, const uint8_t* src, uint32_t npix)
+{
+	uint8_t* d = dst;
+	uint32_t i = 0,run,lit,k;
+
+	while (i < npix) {
+		/* run length at i */
+		for (run = 1; (i + run < npix) && (run < DRLE_MAX_COUNT) &&
+			 (src[(i+run)*2] == src[i*2]) && (src[(i+run)*2+1] == src[i*2+1]); run++);
+
+		if (run >= DRLE_MIN_RUN) {
+			*d++ = (uint8_t)((DRLE_RUN | (run - 1)) >> 8);
+			*d++ = (uint8_t)(run - 1);
+			*d++ = src[i*2];
+			*d++ = src[i*2+1];
+			i += run;
+			continue;
+		}
+
+		/* literal until next worthwhile run */
+		for (lit = run; (i + lit < npix) && (lit < DRLE_MAX_COUNT); lit += k) {
+			for (k = 1; (i + lit + k < npix) && (k < DRLE_MIN_RUN) &&
+				 (src[(i+lit+k)*2] == src[(i+lit)*2]) && (src[(i+lit+k)*2+1] == src[(i+lit)*2+1]); k++);
+			if (k >= DRLE_MIN_RUN) break;
+		}
+		if (lit > DRLE_MAX_COUNT) lit = DRLE_MAX_COUNT;
+
+		*d++ = (uint8_t)((lit - 1) >> 8);
+		*d++ = (uint8_t)(lit - 1);
+		memcpy(d, &src[i*2], lit * 2);
+		d += lit * 2;
+		i += lit;
+	}
+
+	return (uint32_t)(d - dst);
+}
+
+/**************************************************************************/
+/*!
+    Bus Output Helpers.
+*/
+/**************************************************************************/
+static inline void DispRLE_block(const DispOps_t* ops, const uint8_t* p, uint32_t bytes)
+{
+	ops->wr_block((uint8_t*)p, bytes);
+	DispRLE_Stat.bus_bytes += bytes;
+}
+
+/* Send whole 4byte part of staging,odd pixel is kept or sent by wr_gram */
+static void DispRLE_flush(const DispOps_t* ops, int last)
+{
+	uint32_t n = drle_sfill & ~3u;
+
+	if (n) DispRLE_block(ops, drle_stage, n);
+
+	if (drle_sfill & 2) {
+		if (last) {
+			ops->wr_gram((uint16_t)(drle_stage[n] << 8 | drle_stage[n+1]));
+			DispRLE_Stat.bus_bytes += 2;
+			drle_sfill = 0;
+			return;
+		}
+		drle_stage[0] = drle_stage[n];
+		drle_stage[1] = drle_stage[n+1];
+	}
+	drle_sfill &= 2;
+}
+
+static void DispRLE_put(const DispOps_t* ops, const uint8_t* p, uint32_t npix, int repeat)
+{
+	while (npix--) {
+		drle_stage[drle_sfill++] = p[0];
+		drle_stage[drle_sfill++] = p[1];
+		if (!repeat) p += 2;
+		if (drle_sfill == DRLE_BUF_BYTES) DispRLE_flush(ops, 0);
+	}
+}
+
+/**************************************************************************/
+/*!
+    Blit RLE Stream into Window(END point manner).
+	Long runs are sent from replicated fill buffer without expanding
+	whole run,long literals are sent by wr_block directly from src.
+	Returns 0 on success,-1 on short stream.
+*/
+/**************************************************************************/
+int DispRLE_blit(uint16_t x, uint16_t width, uint16_t y, uint16_t height, const uint8_t* src, uint32_t size, const DispOps_t* ops)
+{
+	const uint8_t* end = src + size;
+	uint32_t left = (uint32_t)(width - x + 1) * (height - y + 1);
+	uint32_t n,k,i;
+	uint16_t hdr;
+
+	ops->rect(x, width, y, height);
+	drle_sfill = 0;
+	DispRLE_Stat.src_bytes += size;
+
+	while (left && (src + 2 <= end)) {
+		hdr = (uint16_t)(src[0] << 8 | src[1]);
+		src += 2;
+		n = (uint32_t)(hdr & 0x7FFF) + 1;
+		if (n > left) n = left;
+
+		if (hdr & DRLE_RUN) {
+			if (src + 2 > end) break;
+
+			if (n < DRLE_DIRECT_MIN) {
+				DispRLE_put(ops, src, n, 1);
+			}
+			else {
+				/* even up staging,then fill */
+				if (drle_sfill & 2) { DispRLE_put(ops, src, 1, 1); n--; left--; }
+				DispRLE_flush(ops, 0);
+
+				if (drle_fillcol != (int32_t)(src[0] << 8 | src[1])) {
+					for (i = 0; i < DRLE_BUF_BYTES; i += 2) {
+						drle_fill[i]   = src[0];
+						drle_fill[i+1] = src[1];
+					}
+					drle_fillcol = (int32_t)(src[0] << 8 | src[1]);
+				}
+				for (k = n & ~1u; k; k -= i) {
+					i = (k > DRLE_BUF_PIXELS) ? DRLE_BUF_PIXELS : k;
+					DispRLE_block(ops, drle_fill, i * 2);
+				}
+				if (n & 1) DispRLE_put(ops, src, 1, 1);
+				DispRLE_Stat.fills++;
+			}
+			src += 2;
+		}
+		else {
+			if (src + n * 2 > end) break;
+
+			if (n < DRLE_DIRECT_MIN) {
+				DispRLE_put(ops, src, n, 0);
+			}
+			else {
+				/* even up staging,then send in place */
+				i = 0;
+				if (drle_sfill & 2) { DispRLE_put(ops, src, 1, 0); i = 1; }
+				DispRLE_flush(ops, 0);
+
+				k = (n - i) & ~1u;
+				DispRLE_block(ops, src + i * 2, k * 2);
+				if ((n - i) & 1) DispRLE_put(ops, src + (i + k) * 2, 1, 0);
+				DispRLE_Stat.directs++;
+			}
+			src += ((hdr & 0x7FFF) + 1) * 2;
+		}
+		left -= n;
+	}
+
+	DispRLE_flush(ops, 1);
+
+	return left ? -1 : 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
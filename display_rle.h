@@ -0,0 +1,68 @@
+/********************************************************************************/
+/*!
+	@file			display_rle.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Run-Length Compressed RGB565 Image Blitter and Encoder.	@n
+					Runs become fills,literals go to wr_block in place.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_RLE_H
+#define DISPLAY_RLE_H 0x0100
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Stream Format(all 16bit words MSB first)
+   [hdr] hdr bit15 = 1 : run,    (hdr&0x7FFF)+1 pixels of next word
+         hdr bit15 = 0 : literal,(hdr&0x7FFF)+1 pixel words follow */
+#define DRLE_RUN			0x8000
+#define DRLE_MAX_COUNT		0x8000
+
+/* Encoder:shortest run stored as run */
+#ifndef DRLE_MIN_RUN
+ #define DRLE_MIN_RUN		3
+#endif
+/* Decoder:shorter runs/literals are gathered in staging buffer */
+#ifndef DRLE_DIRECT_MIN
+ #define DRLE_DIRECT_MIN	16
+#endif
+/* Staging/fill buffer(pixels),MUST be even and >= DRLE_DIRECT_MIN*2 */
+#ifndef DRLE_BUF_PIXELS
+ #define DRLE_BUF_PIXELS	128
+#endif
+
+/* Decode Statistics */
+typedef struct {
+	uint32_t	fills;				/* runs sent as fill */
+	uint32_t	directs;			/* literals sent straight from source */
+	uint32_t	bus_bytes;			/* pixel bytes on the bus */
+	uint32_t	src_bytes;			/* compressed bytes read */
+} DispRLE_Stat_t;
+
+extern DispRLE_Stat_t DispRLE_Stat;
+
+/* RLE Functions Prototype */
+extern uint32_t DispRLE_encode(uint8_t* dst, const uint8_t* src, uint32_t npix);
+extern int DispRLE_blit(uint16_t x, uint16_t width, uint16_t y, uint16_t height, const uint8_t* src, uint32_t size, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_RLE_H */
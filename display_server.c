@@ -0,0 +1,267 @@
+/********************************************************************************/
+/*!
+	@file			display_server.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Display Server for Multi-Task Drawing.					@n
+					Producers post into lock-free MPSC ring,one owner drives bus.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Retire list after submit,check producer id.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_server.h"
+/* check header file version for fool proof */
+#if DISPLAY_SERVER_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DSRV_MASK		(DSRV_RING_SIZE - 1)
+/* Largest single request in staging list(window + blit) */
+#define DSRV_REQ_WORDS	(3 + 2 + DL_PTR_WORDS)
+
+/* Variables -----------------------------------------------------------------*/
+DispSrv_t DispSrv;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize Display Server.
+	Call once before any producer posts.
+*/
+/**************************************************************************/
+void DispSrv_init(const DispOps_t* ops)
+{
+	uint32_t i;
+
+	memset(&DispSrv, 0, sizeof(DispSrv));
+	for (i = 0; i < DSRV_RING_SIZE; i++) DispSrv.slot[i].seq = i;
+
+	DispSrv.ops = *ops;
+	DispList_begin(&DispSrv.dl, DispSrv.list, DSRV_LIST_WORDS);
+}
+
+/**************************************************************************/
+/*!
+    Post Request(any task/ISR).
+	Bounded MPSC ring with per-slot sequence,no lock is taken.
+	Returns DSRV_FULL when the owner is behind,caller decides to retry.
+*/
+/**************************************************************************/
+int DispSrv_post(DispSrv_Req_t* req)
+{
+	uint32_t pos = DSRV_LOAD(&DispSrv.head);
+	uint32_t seq;
+	int32_t  dif;
+
+	if (req->producer >= DSRV_MAX_PRODUCERS) return DSRV_BADID;
+
+	for (;;) {
+		seq = DSRV_LOAD(&DispSrv.slot[pos & DSRV_MASK].seq);
+		dif = (int32_t)(seq - pos);
+
+		if (dif == 0) {
+			if (DSRV_CAS(&DispSrv.head, pos, pos + 1)) break;	/* pos reloaded on fail */
+		}
+		else if (dif < 0) {
+			DispSrv.stat[req->producer].rejected++;
+			return DSRV_FULL;
+		}
+		else {
+			pos = DSRV_LOAD(&DispSrv.head);
+		}
+	}
+
+	req->stamp = DSRV_CLOCK();
+	DispSrv.stat[req->producer].posted++;
+	DispSrv.slot[pos & DSRV_MASK].req = *req;
+	DSRV_STORE(&DispSrv.slot[pos & DSRV_MASK].seq, pos + 1);
+
+	return DSRV_OK;
+}
+
+/**************************************************************************/
+/*!
+    Post Helpers.
+*/
+/**************************************************************************/
+int DispSrv_fill(uint8_t producer, uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint16_t colour)
+{
+	DispSrv_Req_t req;
+
+	req.op		 = DSRV_OP_FILL;
+	req.producer = producer;
+	req.colour	 = colour;
+	req.x = x; req.width = width; req.y = y; req.height = height;
+
+	return DispSrv_post(&req);
+}
+
+int DispSrv_blit(uint8_t producer, uint16_t x, uint16_t width, uint16_t y, uint16_t height, const uint8_t* p, uint32_t bytes)
+{
+	DispSrv_Req_t req;
+
+	req.op		 = DSRV_OP_BLIT;
+	req.producer = producer;
+	req.x = x; req.width = width; req.y = y; req.height = height;
+	req.p		 = p;
+	req.bytes	 = bytes;
+
+	return DispSrv_post(&req);
+}
+
+int DispSrv_list(uint8_t producer, const DispList_t* list)
+{
+	DispSrv_Req_t req;
+
+	req.op		 = DSRV_OP_LIST;
+	req.producer = producer;
+	req.list	 = list;
+
+	return DispSrv_post(&req);
+}
+
+/**************************************************************************/
+/*!
+    Submit Staged List and Retire Requests.
+*/
+/**************************************************************************/
+static void DispSrv_flush(void)
+{
+	uint32_t i,now,lat;
+
+	if (DispSrv.dl.len) {
+		DispList_submit(&DispSrv.dl, &DispSrv.ops);
+		DispSrv.submits++;
+	}
+	DispList_begin(&DispSrv.dl, DispSrv.list, DSRV_LIST_WORDS);
+
+	now = DSRV_CLOCK();
+	for (i = 0; i < DSRV_MAX_PRODUCERS; i++) {
+		if (!DispSrv.staged[i]) continue;
+
+		lat = now - DispSrv.oldest[i];
+		if (lat > DispSrv.stat[i].lat_max) DispSrv.stat[i].lat_max = lat;
+		DispSrv.stat[i].lat_sum += DispSrv.staged[i] * now - DispSrv.stampsum[i];
+		DSRV_STORE(&DispSrv.stat[i].done, DispSrv.stat[i].done + DispSrv.staged[i]);
+
+		DispSrv.staged[i]	= 0;
+		DispSrv.stampsum[i] = 0;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Stage Request for Latency/Completion Accounting.
+*/
+/**************************************************************************/
+static void DispSrv_stage(const DispSrv_Req_t* req)
+{
+	uint8_t id = req->producer;
+
+	if (id >= DSRV_MAX_PRODUCERS) return;
+	if (!DispSrv.staged[id]) DispSrv.oldest[id] = req->stamp;
+	DispSrv.staged[id]++;
+	DispSrv.stampsum[id] += req->stamp;
+}
+
+/**************************************************************************/
+/*!
+    Check a Fill Request Overdraws Given Rectangle.
+*/
+/**************************************************************************/
+static inline int DispSrv_covers(const DispSrv_Req_t* top, const DispSrv_Req_t* req)
+{
+	return (top->op == DSRV_OP_FILL) &&
+		   (top->x <= req->x) && (top->width  >= req->width) &&
+		   (top->y <= req->y) && (top->height >= req->height);
+}
+
+/**************************************************************************/
+/*!
+    Owner Task Body.
+	Drains the ring into one display list and submits it.
+	A fill/blit overdrawn by the next queued fill is dropped.
+	A list request is retired after its own submit,latency covers execution.
+	Returns number of requests handled.
+*/
+/**************************************************************************/
+uint32_t DispSrv_run(void)
+{
+	DispSrv_Req_t req;
+	uint32_t tail = DispSrv.tail;
+	uint32_t cnt  = 0;
+	uint32_t next;
+
+	while (DSRV_LOAD(&DispSrv.slot[tail & DSRV_MASK].seq) == tail + 1) {
+		req = DispSrv.slot[tail & DSRV_MASK].req;
+		DSRV_STORE(&DispSrv.slot[tail & DSRV_MASK].seq, tail + DSRV_RING_SIZE);
+		tail++;
+		cnt++;
+
+		if (req.op != DSRV_OP_LIST) DispSrv_stage(&req);
+
+		/* peek next,skip if it covers this one */
+		next = tail & DSRV_MASK;
+		if ((req.op != DSRV_OP_LIST) &&
+			(DSRV_LOAD(&DispSrv.slot[next].seq) == tail + 1) &&
+			DispSrv_covers(&DispSrv.slot[next].req, &req)) {
+			DispSrv.coalesced++;
+			continue;
+		}
+
+		if (DispSrv.dl.len + DSRV_REQ_WORDS > DSRV_LIST_WORDS) DispSrv_flush();
+
+		switch (req.op) {
+		case DSRV_OP_FILL:
+			DispList_fill_rect(&DispSrv.dl, req.x, req.width, req.y, req.height, req.colour);
+			break;
+		case DSRV_OP_BLIT:
+			DispList_window(&DispSrv.dl, req.x, req.width, req.y, req.height);
+			DispList_blit(&DispSrv.dl, req.p, req.bytes);
+			break;
+		case DSRV_OP_LIST:
+			DispSrv_flush();
+			DispList_submit(req.list, &DispSrv.ops);
+			DispSrv.submits++;
+			DispSrv_stage(&req);
+			DispSrv_flush();
+			break;
+		default:
+			break;
+		}
+	}
+
+	DispSrv.tail = tail;
+	DispSrv_flush();
+
+	return cnt;
+}
+
+/**************************************************************************/
+/*!
+    Check All Requests of the Producer are Done.
+	Buffers passed by blit/list may be reused after this returns 1.
+*/
+/**************************************************************************/
+int DispSrv_idle(uint8_t producer)
+{
+	if (producer >= DSRV_MAX_PRODUCERS) return 1;
+	return DSRV_LOAD(&DispSrv.stat[producer].done) == DispSrv.stat[producer].posted;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,123 @@
+/********************************************************************************/
+/*!
+	@file			display_server.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Display Server for Multi-Task Drawing.					@n
+					Producers post into lock-free MPSC ring,one owner drives bus.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Retire list after submit,check producer id.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_SERVER_H
+#define DISPLAY_SERVER_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_list.h"
+
+/* Ring entries,MUST be power of 2 */
+#ifndef DSRV_RING_SIZE
+ #define DSRV_RING_SIZE		32
+#endif
+#ifndef DSRV_MAX_PRODUCERS
+ #define DSRV_MAX_PRODUCERS	4
+#endif
+/* Staging display list(words) */
+#ifndef DSRV_LIST_WORDS
+ #define DSRV_LIST_WORDS	256
+#endif
+
+/* Latency clock,override for hi-res timer or host build */
+#ifndef DSRV_CLOCK
+ #define DSRV_CLOCK()		ticktime
+ extern volatile uint32_t ticktime;
+#endif
+
+/* Atomic primitives,GCC builtins(Cortex-M3 and later,host).
+   On Cortex-M0 define these with interrupt lock before include. */
+#ifndef DSRV_CAS
+ #define DSRV_CAS(p,o,n)	__atomic_compare_exchange_n((p),&(o),(n),0,__ATOMIC_ACQ_REL,__ATOMIC_RELAXED)
+ #define DSRV_LOAD(p)		__atomic_load_n((p),__ATOMIC_ACQUIRE)
+ #define DSRV_STORE(p,v)	__atomic_store_n((p),(v),__ATOMIC_RELEASE)
+#endif
+
+/* Request Opcodes */
+#define DSRV_OP_FILL		0x01		/* rect + colour */
+#define DSRV_OP_BLIT		0x02		/* rect + p/bytes,p kept until done */
+#define DSRV_OP_LIST		0x03		/* recorded display list,kept until done */
+
+/* Post Result */
+#define DSRV_OK				0
+#define DSRV_FULL			(-1)		/* back-pressure,retry later */
+#define DSRV_BADID			(-2)		/* producer >= DSRV_MAX_PRODUCERS */
+
+/* Draw Request */
+typedef struct {
+	uint8_t				op;
+	uint8_t				producer;
+	uint16_t			colour;
+	uint16_t			x, width, y, height;	/* END point manner */
+	const uint8_t*		p;
+	uint32_t			bytes;
+	const DispList_t*	list;
+	uint32_t			stamp;					/* DSRV_CLOCK() at post */
+} DispSrv_Req_t;
+
+/* Per-Producer Statistics */
+typedef struct {
+	volatile uint32_t	posted;
+	volatile uint32_t	done;			/* posted == done means buffers are free */
+	volatile uint32_t	rejected;		/* DSRV_FULL count */
+	uint32_t			lat_max;
+	uint32_t			lat_sum;		/* average = lat_sum / done */
+} DispSrv_Stat_t;
+
+/* Server State */
+typedef struct {
+	struct {
+		uint32_t		seq;
+		DispSrv_Req_t	req;
+	} slot[DSRV_RING_SIZE];
+	uint32_t			head;			/* producers */
+	uint32_t			tail;			/* owner only */
+	DispOps_t			ops;
+	DispList_t			dl;
+	uint32_t			list[DSRV_LIST_WORDS];
+	uint32_t			staged[DSRV_MAX_PRODUCERS];
+	uint32_t			oldest[DSRV_MAX_PRODUCERS];		/* stamp of first staged */
+	uint32_t			stampsum[DSRV_MAX_PRODUCERS];
+	uint32_t			coalesced;		/* requests dropped as overdrawn */
+	uint32_t			submits;
+	DispSrv_Stat_t		stat[DSRV_MAX_PRODUCERS];
+} DispSrv_t;
+
+extern DispSrv_t DispSrv;
+
+/* Display Server Functions Prototype */
+extern void DispSrv_init(const DispOps_t* ops);
+extern int  DispSrv_post(DispSrv_Req_t* req);
+extern int  DispSrv_fill(uint8_t producer, uint16_t x, uint16_t width, uint16_t y, uint16_t height, uint16_t colour);
+extern int  DispSrv_blit(uint8_t producer, uint16_t x, uint16_t width, uint16_t y, uint16_t height, const uint8_t* p, uint32_t bytes);
+extern int  DispSrv_list(uint8_t producer, const DispList_t* list);
+extern uint32_t DispSrv_run(void);
+extern int  DispSrv_idle(uint8_t producer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_SERVER_H */
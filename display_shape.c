@@ -0,0 +1,370 @@
+/********************************************************************************/
+/*!
+	@file			display_shape.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Span-Based Primitive Rasterizer.							@n
+					Shapes are decomposed into h/v spans,one window fill each.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_shape.h"
+/* check header file version for fool proof */
+#if DISPLAY_SHAPE_H != 0x0100
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#define DSHAPE_ABS(a)		(((a) < 0) ? -(a) : (a))
+
+/* Variables -----------------------------------------------------------------*/
+DispShape_Stat_t DispShape_Stat;
+static DispOps_t dshape_ops;
+static int16_t   dshape_max_x, dshape_max_y;
+static uint8_t   dshape_fill[DSHAPE_FILL_PIXELS*2];
+static int32_t   dshape_fillcol = -1;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize Rasterizer with Driver and Panel Size.
+*/
+/**************************************************************************/
+void DispShape_init(const DispOps_t* ops, uint16_t max_x, uint16_t max_y)
+{
+	dshape_ops	 = *ops;
+	dshape_max_x = (int16_t)max_x;
+	dshape_max_y = (int16_t)max_y;
+}
+
+/**************************************************************************/
+/*!
+    Fill Rectangle,one window(clipped).
+*/
+/**************************************************************************/
+void DispShape_fill_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour)
+{
+	uint32_t n,k,i;
+	int16_t  t;
+
+	if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+	if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= dshape_max_x) x1 = dshape_max_x - 1;
+	if (y1 >= dshape_max_y) y1 = dshape_max_y - 1;
+	if ((x0 > x1) || (y0 > y1)) return;
+
+	if (dshape_fillcol != colour) {
+		for (i = 0; i < sizeof(dshape_fill); i += 2) {
+			dshape_fill[i]   = (uint8_t)(colour >> 8);
+			dshape_fill[i+1] = (uint8_t)colour;
+		}
+		dshape_fillcol = colour;
+	}
+
+	dshape_ops.rect((uint32_t)x0, (uint32_t)x1, (uint32_t)y0, (uint32_t)y1);
+	n = (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
+	DispShape_Stat.windows++;
+	DispShape_Stat.pixels += n;
+
+	for (k = n & ~1u; k; k -= i) {
+		i = (k > DSHAPE_FILL_PIXELS) ? DSHAPE_FILL_PIXELS : k;
+		dshape_ops.wr_block(dshape_fill, i * 2);
+	}
+	if (n & 1) dshape_ops.wr_gram(colour);
+}
+
+void DispShape_hline(int16_t x0, int16_t x1, int16_t y, uint16_t colour)
+{
+	DispShape_fill_rect(x0, y, x1, y, colour);
+}
+
+void DispShape_vline(int16_t x, int16_t y0, int16_t y1, uint16_t colour)
+{
+	DispShape_fill_rect(x, y0, x, y1, colour);
+}
+
+/**************************************************************************/
+/*!
+    Draw Line,Bresenham runs become h/v spans.
+*/
+/**************************************************************************/
+void DispShape_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour)
+{
+	int32_t dx =  DSHAPE_ABS(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+	int32_t dy = -DSHAPE_ABS(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+	int32_t err = dx + dy, e2;
+	int16_t px = x0, py = y0, s = (dx >= -dy) ? x0 : y0;
+
+	for (;;) {
+		if ((x0 == x1) && (y0 == y1)) break;
+		e2 = 2 * err;
+		if (e2 >= dy) { err += dy; x0 = (int16_t)(x0 + sx); }
+		if (e2 <= dx) { err += dx; y0 = (int16_t)(y0 + sy); }
+
+		if (dx >= -dy) {
+			/* x-major,run ends when y moves */
+			if (y0 != py) { DispShape_hline(s, px, py, colour); s = x0; }
+		}
+		else {
+			if (x0 != px) { DispShape_vline(px, s, py, colour); s = y0; }
+		}
+		px = x0; py = y0;
+	}
+
+	if (dx >= -dy)	DispShape_hline(s, px, py, colour);
+	else			DispShape_vline(px, s, py, colour);
+}
+
+/**************************************************************************/
+/*!
+    Draw Rectangle Outline,four spans.
+*/
+/**************************************************************************/
+void DispShape_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour)
+{
+	DispShape_hline(x0, x1, y0, colour);
+	DispShape_hline(x0, x1, y1, colour);
+	if (DSHAPE_ABS(y1 - y0) < 2) return;
+	DispShape_vline(x0, (int16_t)(y0 + ((y0 < y1) ? 1 : -1)), (int16_t)(y1 - ((y0 < y1) ? 1 : -1)), colour);
+	DispShape_vline(x1, (int16_t)(y0 + ((y0 < y1) ? 1 : -1)), (int16_t)(y1 - ((y0 < y1) ? 1 : -1)), colour);
+}
+
+/**************************************************************************/
+/*!
+    Quarter Arcs around (cxl/cxr,cyt/cyb).
+	Midpoint runs of one octant are horizontal spans there and vertical
+	spans in the mirrored octant,filled arcs become rectangles.
+*/
+/**************************************************************************/
+static void DispShape_arcs(int16_t cxl, int16_t cxr, int16_t cyt, int16_t cyb, int16_t r, uint16_t colour, uint8_t fill)
+{
+	int32_t x = 0, y = r, d = 1 - r, nx, ny, xs = 0;
+
+	while (x <= y) {
+		nx = x + 1;
+		ny = y;
+		if (d < 0)	d += 2 * x + 3;
+		else		{ d += 2 * (x - y) + 5; ny = y - 1; }
+
+		if ((ny != y) || (nx > ny)) {
+			/* run xs..x at height y */
+			if (fill) {
+				DispShape_fill_rect((int16_t)(cxl - x), (int16_t)(cyb + y), (int16_t)(cxr + x), (int16_t)(cyb + y), colour);
+				DispShape_fill_rect((int16_t)(cxl - x), (int16_t)(cyt - y), (int16_t)(cxr + x), (int16_t)(cyt - y), colour);
+				DispShape_fill_rect((int16_t)(cxl - y), (int16_t)(cyb + xs), (int16_t)(cxr + y), (int16_t)(cyb + x), colour);
+				DispShape_fill_rect((int16_t)(cxl - y), (int16_t)(cyt - x), (int16_t)(cxr + y), (int16_t)(cyt - xs), colour);
+			}
+			else {
+				DispShape_hline((int16_t)(cxr + xs), (int16_t)(cxr + x), (int16_t)(cyb + y), colour);
+				DispShape_hline((int16_t)(cxl - x), (int16_t)(cxl - xs), (int16_t)(cyb + y), colour);
+				DispShape_hline((int16_t)(cxr + xs), (int16_t)(cxr + x), (int16_t)(cyt - y), colour);
+				DispShape_hline((int16_t)(cxl - x), (int16_t)(cxl - xs), (int16_t)(cyt - y), colour);
+				DispShape_vline((int16_t)(cxr + y), (int16_t)(cyb + xs), (int16_t)(cyb + x), colour);
+				DispShape_vline((int16_t)(cxl - y), (int16_t)(cyb + xs), (int16_t)(cyb + x), colour);
+				DispShape_vline((int16_t)(cxr + y), (int16_t)(cyt - x), (int16_t)(cyt - xs), colour);
+				DispShape_vline((int16_t)(cxl - y), (int16_t)(cyt - x), (int16_t)(cyt - xs), colour);
+			}
+			xs = nx;
+		}
+		x = nx;
+		y = ny;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Draw Circle / Filled Circle.
+*/
+/**************************************************************************/
+void DispShape_circle(int16_t cx, int16_t cy, int16_t r, uint16_t colour)
+{
+	DispShape_arcs(cx, cx, cy, cy, r, colour, 0);
+}
+
+void DispShape_fill_circle(int16_t cx, int16_t cy, int16_t r, uint16_t colour)
+{
+	DispShape_arcs(cx, cx, cy, cy, r, colour, 1);
+}
+
+/**************************************************************************/
+/*!
+    Draw Rounded Rectangle / Filled Rounded Rectangle.
+*/
+/**************************************************************************/
+void DispShape_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t colour)
+{
+	DispShape_hline((int16_t)(x0 + r), (int16_t)(x1 - r), y0, colour);
+	DispShape_hline((int16_t)(x0 + r), (int16_t)(x1 - r), y1, colour);
+	DispShape_vline(x0, (int16_t)(y0 + r), (int16_t)(y1 - r), colour);
+	DispShape_vline(x1, (int16_t)(y0 + r), (int16_t)(y1 - r), colour);
+	DispShape_arcs((int16_t)(x0 + r), (int16_t)(x1 - r), (int16_t)(y0 + r), (int16_t)(y1 - r), r, colour, 0);
+}
+
+void DispShape_fill_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t colour)
+{
+	DispShape_fill_rect(x0, (int16_t)(y0 + r), x1, (int16_t)(y1 - r), colour);
+	DispShape_arcs((int16_t)(x0 + r), (int16_t)(x1 - r), (int16_t)(y0 + r), (int16_t)(y1 - r), r, colour, 1);
+}
+
+/**************************************************************************/
+/*!
+    Fill Polygon(xy = x0,y0,x1,y1...),even-odd rule.
+	Rows with the same spans as the row above are merged into rectangles.
+*/
+/**************************************************************************/
+void DispShape_fill_poly(const int16_t* xy, uint8_t n, uint16_t colour)
+{
+	int16_t xs[DSHAPE_MAX_POLY], ps[DSHAPE_MAX_POLY];
+	int16_t ymin, ymax, y, py0 = 0, t;
+	uint8_t i,j,k,m,pm = 0;
+	int32_t xi,yi,xj,yj;
+
+	if ((n < 3) || (n > DSHAPE_MAX_POLY)) return;
+
+	ymin = ymax = xy[1];
+	for (i = 1; i < n; i++) {
+		if (xy[i*2+1] < ymin) ymin = xy[i*2+1];
+		if (xy[i*2+1] > ymax) ymax = xy[i*2+1];
+	}
+
+	for (y = ymin; y <= ymax + 1; y++) {
+		m = 0;
+		for (i = 0, j = (uint8_t)(n - 1); (y <= ymax) && (i < n); j = i++) {
+			xi = xy[i*2]; yi = xy[i*2+1];
+			xj = xy[j*2]; yj = xy[j*2+1];
+			if (((yi <= y) && (yj > y)) || ((yj <= y) && (yi > y))) {
+				xs[m++] = (int16_t)(xi + ((y - yi) * (xj - xi) + (yj - yi) / 2) / (yj - yi));
+			}
+		}
+		/* insertion sort */
+		for (i = 1; i < m; i++) {
+			for (t = xs[i], k = i; (k > 0) && (xs[k-1] > t); k--) xs[k] = xs[k-1];
+			xs[k] = t;
+		}
+
+		/* same spans as pending rows,extend */
+		if ((m == pm) && !memcmp(xs, ps, m * sizeof(int16_t))) continue;
+
+		for (k = 0; k + 1 < pm; k += 2) {
+			DispShape_fill_rect(ps[k], py0, ps[k+1], (int16_t)(y - 1), colour);
+		}
+		memcpy(ps, xs, m * sizeof(int16_t));
+		pm  = m;
+		py0 = y;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Blend Pixel into DispFB Back Buffer,a = 0..255.
+*/
+/**************************************************************************/
+static void DispShape_plot_aa(int32_t x, int32_t y, uint16_t colour, uint32_t a)
+{
+	uint16_t* p;
+	uint32_t  d,r,g,b;
+
+	if ((x < 0) || (y < 0) || ((uint32_t)x >= DispFB.width) || ((uint32_t)y >= DispFB.height)) return;
+
+	p = &DispFB.buf[DispFB.back][(uint32_t)y * DispFB.stride + (uint32_t)x];
+	d = *p;
+	r = ((colour >> 11)        * a + (d >> 11)        * (255 - a) + 127) / 255;
+	g = (((colour >> 5) & 0x3F) * a + ((d >> 5) & 0x3F) * (255 - a) + 127) / 255;
+	b = ((colour & 0x1F)        * a + (d & 0x1F)        * (255 - a) + 127) / 255;
+	*p = (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**************************************************************************/
+/*!
+    Anti-Aliased Line(Xiaolin Wu),16.16 fixed point.
+*/
+/**************************************************************************/
+void DispShape_line_aa(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour)
+{
+	int32_t dx = x1 - x0, dy = y1 - y0, i, n, grad, pos;
+	uint32_t f;
+
+	if (DSHAPE_ABS(dx) >= DSHAPE_ABS(dy)) {
+		if (dx < 0) { dx = -dx; dy = -dy; x0 = x1; y0 = y1; }
+		grad = dx ? (dy * 65536) / dx : 0;
+		pos  = y0 * 65536;
+		for (i = 0, n = dx; i <= n; i++, pos += grad) {
+			f = (uint32_t)(pos & 0xFFFF) >> 8;
+			DispShape_plot_aa(x0 + i, pos >> 16,       colour, 255 - f);
+			DispShape_plot_aa(x0 + i, (pos >> 16) + 1, colour, f);
+		}
+	}
+	else {
+		if (dy < 0) { dx = -dx; dy = -dy; x0 = x1; y0 = y1; }
+		grad = (dx * 65536) / dy;
+		pos  = x0 * 65536;
+		for (i = 0, n = dy; i <= n; i++, pos += grad) {
+			f = (uint32_t)(pos & 0xFFFF) >> 8;
+			DispShape_plot_aa(pos >> 16,       y0 + i, colour, 255 - f);
+			DispShape_plot_aa((pos >> 16) + 1, y0 + i, colour, f);
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Integer Square Root.
+*/
+/**************************************************************************/
+static uint32_t DispShape_isqrt(uint32_t v)
+{
+	uint32_t r = 0, b = 1UL << 30;
+
+	while (b > v) b >>= 2;
+	while (b) {
+		if (v >= r + b) { v -= r + b; r = (r >> 1) + b; }
+		else			r >>= 1;
+		b >>= 2;
+	}
+
+	return r;
+}
+
+/**************************************************************************/
+/*!
+    Anti-Aliased Circle,8-way symmetric,8.8 fixed point radius.
+*/
+/**************************************************************************/
+void DispShape_circle_aa(int16_t cx, int16_t cy, int16_t r, uint16_t colour)
+{
+	int32_t x, yi;
+	uint32_t yf, f;
+
+	for (x = 0; x * 1414 <= r * 1000 + 500; x++) {
+		yf = DispShape_isqrt((uint32_t)(r * r - x * x) << 16);	/* 8.8 */
+		yi = (int32_t)(yf >> 8);
+		f  = yf & 0xFF;
+
+		DispShape_plot_aa(cx + x, cy + yi,     colour, 255 - f);	DispShape_plot_aa(cx + x, cy + yi + 1, colour, f);
+		DispShape_plot_aa(cx - x, cy + yi,     colour, 255 - f);	DispShape_plot_aa(cx - x, cy + yi + 1, colour, f);
+		DispShape_plot_aa(cx + x, cy - yi,     colour, 255 - f);	DispShape_plot_aa(cx + x, cy - yi - 1, colour, f);
+		DispShape_plot_aa(cx - x, cy - yi,     colour, 255 - f);	DispShape_plot_aa(cx - x, cy - yi - 1, colour, f);
+		DispShape_plot_aa(cx + yi,     cy + x, colour, 255 - f);	DispShape_plot_aa(cx + yi + 1, cy + x, colour, f);
+		DispShape_plot_aa(cx + yi,     cy - x, colour, 255 - f);	DispShape_plot_aa(cx + yi + 1, cy - x, colour, f);
+		DispShape_plot_aa(cx - yi,     cy + x, colour, 255 - f);	DispShape_plot_aa(cx - yi - 1, cy + x, colour, f);
+		DispShape_plot_aa(cx - yi,     cy - x, colour, 255 - f);	DispShape_plot_aa(cx - yi - 1, cy - x, colour, f);
+	}
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
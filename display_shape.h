@@ -0,0 +1,70 @@
+/********************************************************************************/
+/*!
+	@file			display_shape.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Span-Based Primitive Rasterizer.							@n
+					Shapes are decomposed into h/v spans,one window fill each.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_SHAPE_H
+#define DISPLAY_SHAPE_H 0x0100
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+#include "display_fb.h"
+
+/* Fill buffer(pixels),MUST be even */
+#ifndef DSHAPE_FILL_PIXELS
+ #define DSHAPE_FILL_PIXELS	64
+#endif
+/* Polygon vertices */
+#ifndef DSHAPE_MAX_POLY
+ #define DSHAPE_MAX_POLY	16
+#endif
+
+/* Statistics */
+typedef struct {
+	uint32_t	windows;			/* window setups */
+	uint32_t	pixels;
+} DispShape_Stat_t;
+
+extern DispShape_Stat_t DispShape_Stat;
+
+/* Span Primitives Functions Prototype */
+extern void DispShape_init(const DispOps_t* ops, uint16_t max_x, uint16_t max_y);
+extern void DispShape_fill_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+extern void DispShape_hline(int16_t x0, int16_t x1, int16_t y, uint16_t colour);
+extern void DispShape_vline(int16_t x, int16_t y0, int16_t y1, uint16_t colour);
+extern void DispShape_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+extern void DispShape_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+extern void DispShape_circle(int16_t cx, int16_t cy, int16_t r, uint16_t colour);
+extern void DispShape_fill_circle(int16_t cx, int16_t cy, int16_t r, uint16_t colour);
+extern void DispShape_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t colour);
+extern void DispShape_fill_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t colour);
+extern void DispShape_fill_poly(const int16_t* xy, uint8_t n, uint16_t colour);
+
+/* Anti-Aliased Variants,draw into DispFB back buffer */
+extern void DispShape_line_aa(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+extern void DispShape_circle_aa(int16_t cx, int16_t cy, int16_t r, uint16_t colour);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_SHAPE_H */
@@ -0,0 +1,170 @@
+/********************************************************************************/
+/*!
+	@file			display_sprite.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Colour-Keyed Sprites Pre-Scanned into Opaque Rectangles.	@n
+					One window + wr_block per rectangle,clipped at panel edge.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Emit by shared DispOps_emit.
+		2026.10.19	V3.00	Pool short is -1,empty sprite is valid.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_sprite.h"
+/* check header file version for fool proof */
+#if DISPLAY_SPRITE_H != 0x0300
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+/* Clip Area,pass MAX_X/MAX_Y(or Display_max_x_if/max_y_if after rotation) */
+static uint16_t dspr_max_x = 0xFFFF;
+static uint16_t dspr_max_y = 0xFFFF;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Build Sprite from Native RGB565 Bitmap.
+	Pixels equal to key are transparent.
+	pool receives rectangles then pixels,returns bytes used,-1 if short.
+	A fully transparent bitmap gives an empty sprite(0 bytes,no rect).
+	spr is always valid,empty on failure.
+*/
+/**************************************************************************/
+int32_t DispSprite_build(DispSprite_t* spr, const uint16_t* src, uint16_t width, uint16_t height, uint16_t key, void* pool, uint32_t poolsize)
+{
+	DispSprite_Rect_t* rect = (DispSprite_Rect_t*)pool;
+	uint32_t maxrect = poolsize / sizeof(DispSprite_Rect_t);
+	uint32_t n = 0, first = 0, opaque = 0;
+	uint32_t i,j,k,x,len,used;
+	uint8_t* pix;
+	uint16_t c;
+
+	spr->width	= width;
+	spr->height	= height;
+	spr->nrect	= 0;
+	spr->rect	= rect;
+	spr->pix	= (const uint8_t*)pool;
+
+	/* pass 1,spans to rectangles */
+	for (j = 0; j < height; j++) {
+		uint32_t rowfirst = n;
+
+		for (x = 0; x < width; x += len) {
+			for (len = 0; (x + len < width) && (src[j*width + x + len] == key); len++);
+			x += len;
+			for (len = 0; (x + len < width) && (src[j*width + x + len] != key); len++);
+			if (!len) continue;
+			opaque += len;
+
+			/* extend rectangle ending at previous row */
+			for (k = first; k < rowfirst; k++) {
+				if ((rect[k].x == x) && (rect[k].w == len) && (rect[k].y + rect[k].h == j)) break;
+			}
+			if (k < rowfirst) {
+				rect[k].h++;
+				continue;
+			}
+
+			if (n >= maxrect) return -1;
+			rect[n].x = (uint16_t)x;
+			rect[n].y = (uint16_t)j;
+			rect[n].w = (uint16_t)len;
+			rect[n].h = 1;
+			n++;
+		}
+
+		/* rectangles not reaching this row are closed */
+		while ((first < n) && (rect[first].y + rect[first].h < j + 1) && (first < rowfirst)) first++;
+	}
+
+	used = n * sizeof(DispSprite_Rect_t);
+	if (used + opaque * 2 > poolsize) return -1;
+
+	/* pass 2,pixels in rectangle order */
+	pix = (uint8_t*)pool + used;
+	for (k = 0, i = 0; k < n; k++) {
+		rect[k].ofs = i;
+		for (j = rect[k].y; j < (uint32_t)rect[k].y + rect[k].h; j++) {
+			for (x = rect[k].x; x < (uint32_t)rect[k].x + rect[k].w; x++, i++) {
+				c = src[j*width + x];
+				pix[i*2]   = (uint8_t)(c >> 8);
+				pix[i*2+1] = (uint8_t)c;
+			}
+		}
+	}
+
+	spr->nrect	= (uint16_t)n;
+	spr->pix	= pix;
+
+	return (int32_t)(used + opaque * 2);
+}
+
+/**************************************************************************/
+/*!
+    Set Clip Area(panel size).
+*/
+/**************************************************************************/
+void DispSprite_set_clip(uint16_t max_x, uint16_t max_y)
+{
+	dspr_max_x = max_x;
+	dspr_max_y = max_y;
+}
+
+/**************************************************************************/
+/*!
+    Blit Sprite at (x,y),may be partly outside the panel.
+	Returns number of windows set.
+*/
+/**************************************************************************/
+uint32_t DispSprite_blit(const DispSprite_t* spr, int16_t x, int16_t y, const DispOps_t* ops)
+{
+	const DispSprite_Rect_t* r = spr->rect;
+	uint32_t wins = 0;
+	int32_t  x0,x1,y0,y1,cx0,cx1,cy0,cy1,j;
+	uint16_t k;
+
+	for (k = 0; k < spr->nrect; k++, r++) {
+		x0 = x + r->x; x1 = x0 + r->w - 1;
+		y0 = y + r->y; y1 = y0 + r->h - 1;
+
+		cx0 = (x0 < 0) ? 0 : x0;
+		cy0 = (y0 < 0) ? 0 : y0;
+		cx1 = (x1 >= dspr_max_x) ? dspr_max_x - 1 : x1;
+		cy1 = (y1 >= dspr_max_y) ? dspr_max_y - 1 : y1;
+		if ((cx0 > cx1) || (cy0 > cy1)) continue;
+
+		ops->rect((uint32_t)cx0, (uint32_t)cx1, (uint32_t)cy0, (uint32_t)cy1);
+		wins++;
+
+		if ((cx0 == x0) && (cx1 == x1)) {
+			/* whole rows,one burst */
+			DispOps_emit(ops, spr->pix + (r->ofs + (uint32_t)(cy0 - y0) * r->w) * 2, (uint32_t)(cy1 - cy0 + 1) * r->w * 2);
+		}
+		else {
+			for (j = cy0; j <= cy1; j++) {
+				DispOps_emit(ops, spr->pix + (r->ofs + (uint32_t)(j - y0) * r->w + (uint32_t)(cx0 - x0)) * 2, (uint32_t)(cx1 - cx0 + 1) * 2);
+			}
+		}
+	}
+
+	return wins;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
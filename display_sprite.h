@@ -0,0 +1,59 @@
+/********************************************************************************/
+/*!
+	@file			display_sprite.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Colour-Keyed Sprites Pre-Scanned into Opaque Rectangles.	@n
+					One window + wr_block per rectangle,clipped at panel edge.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Emit by shared DispOps_emit.
+		2026.10.19	V3.00	Pool short is -1,empty sprite is valid.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_SPRITE_H
+#define DISPLAY_SPRITE_H 0x0300
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Opaque Rectangle,pixels are w*h contiguous from ofs */
+typedef struct {
+	uint16_t	x, y;				/* in sprite */
+	uint16_t	w, h;
+	uint32_t	ofs;				/* pixel index in pix */
+} DispSprite_Rect_t;
+
+/* Pre-Scanned Sprite
+   Horizontal opaque spans are merged downward while x/width match,
+   so most shapes need a few windows only. */
+typedef struct {
+	uint16_t					width, height;
+	uint16_t					nrect;
+	const DispSprite_Rect_t*	rect;
+	const uint8_t*				pix;	/* RGB565 bus byte order(MSB first) */
+} DispSprite_t;
+
+/* Sprite Functions Prototype */
+extern int32_t DispSprite_build(DispSprite_t* spr, const uint16_t* src, uint16_t width, uint16_t height, uint16_t key, void* pool, uint32_t poolsize);
+extern void DispSprite_set_clip(uint16_t max_x, uint16_t max_y);
+extern uint32_t DispSprite_blit(const DispSprite_t* spr, int16_t x, int16_t y, const DispOps_t* ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_SPRITE_H */
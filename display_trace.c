@@ -0,0 +1,418 @@
+/********************************************************************************/
+/*!
+	@file			display_trace.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Bus Transaction Trace Recorder,Replayer and GRAM Model.	@n
+					For golden traces of driver init and drawing on the host.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Repeat period up to 8 events for CS framed SPI pixels.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_trace.h"
+/* check header file version for fool proof */
+#if DISPLAY_TRACE_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+#if DTRACE_MAX_PERIOD > 8
+ #error "DTRACE_MAX_PERIOD MUST be 8 or less!"
+#endif
+
+/* Variables -----------------------------------------------------------------*/
+volatile uint16_t DispTrace_port;				/* bus stand-in data/command port */
+static uint8_t*  dtrace_buf;
+static uint32_t  dtrace_size, dtrace_len;
+static uint8_t   dtrace_overflow;
+static DispTrace_Ev_t dtrace_hist[DTRACE_MAX_PERIOD];	/* [0] newest */
+static uint32_t  dtrace_nhist;
+static uint32_t  dtrace_run;
+static uint8_t   dtrace_period;
+static uint8_t   dtrace_pins, dtrace_known, dtrace_wr_low;
+static const uint16_t* dtrace_rdval;
+static uint32_t  dtrace_rdn;
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Store Tag and LEB128 Value.
+*/
+/**************************************************************************/
+static void DispTrace_put(uint8_t type, uint32_t val)
+{
+	if (dtrace_len >= dtrace_size) { dtrace_overflow = 1; return; }
+	dtrace_buf[dtrace_len++] = type;
+
+	do {
+		if (dtrace_len >= dtrace_size) { dtrace_overflow = 1; return; }
+		dtrace_buf[dtrace_len++] = (uint8_t)((val & 0x7F) | ((val > 0x7F) ? 0x80 : 0));
+		val >>= 7;
+	} while (val);
+}
+
+/**************************************************************************/
+/*!
+    Store Event and Push to History.
+*/
+/**************************************************************************/
+static void DispTrace_emit(DispTrace_Ev_t ev)
+{
+	DispTrace_put(ev.type, ev.val);
+	memmove(&dtrace_hist[1], &dtrace_hist[0], sizeof(dtrace_hist) - sizeof(dtrace_hist[0]));
+	dtrace_hist[0] = ev;
+	if (dtrace_nhist < DTRACE_MAX_PERIOD) dtrace_nhist++;
+}
+
+/**************************************************************************/
+/*!
+    Close Pending Repeat,partial pattern is stored as it is.
+*/
+/**************************************************************************/
+static void DispTrace_flush(void)
+{
+	DispTrace_Ev_t pat[DTRACE_MAX_PERIOD];
+	uint32_t full = dtrace_run / dtrace_period;
+	uint32_t rest = dtrace_run % dtrace_period;
+	uint32_t k;
+
+	uint32_t total = full * dtrace_period;
+	uint8_t  p = dtrace_period;
+
+	for (k = 0; k < p; k++) pat[k] = dtrace_hist[p - 1 - k];
+	dtrace_period = 0;
+	dtrace_run	  = 0;
+
+	if (full) {
+		DispTrace_put(DTRACE_REPEAT, full << 3 | (p - 1));
+		/* history as the reader sees it after expansion */
+		for (k = (total > DTRACE_MAX_PERIOD) ? total - DTRACE_MAX_PERIOD : 0; k < total; k++) {
+			memmove(&dtrace_hist[1], &dtrace_hist[0], sizeof(dtrace_hist) - sizeof(dtrace_hist[0]));
+			dtrace_hist[0] = pat[k % p];
+		}
+		dtrace_nhist = (dtrace_nhist + total > DTRACE_MAX_PERIOD) ? DTRACE_MAX_PERIOD : dtrace_nhist + total;
+	}
+	for (k = 0; k < rest; k++) DispTrace_emit(pat[k]);
+}
+
+/**************************************************************************/
+/*!
+    Start Recording into buf.
+*/
+/**************************************************************************/
+void DispTrace_begin(uint8_t* buf, uint32_t size)
+{
+	dtrace_buf		= buf;
+	dtrace_size		= size;
+	dtrace_len		= 0;
+	dtrace_overflow = 0;
+	dtrace_nhist	= 0;
+	dtrace_run		= 0;
+	dtrace_period	= 0;
+	dtrace_known	= 0;
+	dtrace_wr_low	= 0;
+}
+
+/**************************************************************************/
+/*!
+    Stop Recording,returns trace bytes(0 = buffer was short).
+*/
+/**************************************************************************/
+uint32_t DispTrace_end(void)
+{
+	if (dtrace_period) DispTrace_flush();
+
+	return dtrace_overflow ? 0 : dtrace_len;
+}
+
+/**************************************************************************/
+/*!
+    Record Event,repeats of the last 1..DTRACE_MAX_PERIOD events are folded.
+*/
+/**************************************************************************/
+void DispTrace_event(uint8_t type, uint16_t val)
+{
+	DispTrace_Ev_t ev;
+	const DispTrace_Ev_t* e;
+	uint32_t p;
+
+	ev.type = type;
+	ev.val	= val;
+
+	if (dtrace_period) {
+		e = &dtrace_hist[dtrace_period - 1 - dtrace_run % dtrace_period];
+		if ((e->type == type) && (e->val == val)) { dtrace_run++; return; }
+		DispTrace_flush();
+	}
+
+	/* longest period first,catches CS/DC framed transfers */
+	for (p = dtrace_nhist; p; p--) {
+		if ((dtrace_hist[p-1].type == type) && (dtrace_hist[p-1].val == val)) {
+			dtrace_period = (uint8_t)p;
+			dtrace_run	  = 1;
+			return;
+		}
+	}
+
+	DispTrace_emit(ev);
+}
+
+/**************************************************************************/
+/*!
+    Bus Stand-In Hooks.
+	pin:recorded on level change only.
+	wr:WR L->H edge,DispTrace_port goes as command(DC=L) or data.
+	spi:one byte on SPI,command or data by DC.
+*/
+/**************************************************************************/
+void DispTrace_pin(uint8_t pin, uint8_t level)
+{
+	uint8_t bit = (uint8_t)(1u << pin);
+
+	if ((dtrace_known & bit) && (((dtrace_pins & bit) != 0) == (level != 0))) return;
+	dtrace_known |= bit;
+	dtrace_pins   = level ? (dtrace_pins | bit) : (dtrace_pins & ~bit);
+	DispTrace_event(DTRACE_PIN, (uint16_t)(pin << 1 | (level != 0)));
+}
+
+void DispTrace_wr(uint8_t level)
+{
+	if (!level)				dtrace_wr_low = 1;
+	else if (dtrace_wr_low) {
+		dtrace_wr_low = 0;
+		DispTrace_event((dtrace_pins & (1u << DTRACE_PIN_DC)) ? DTRACE_DAT : DTRACE_CMD, DispTrace_port);
+	}
+}
+
+void DispTrace_spi(uint8_t dat)
+{
+	DispTrace_event((dtrace_pins & (1u << DTRACE_PIN_DC)) ? DTRACE_DAT : DTRACE_CMD, dat);
+}
+
+void DispTrace_delay(uint32_t ms)
+{
+	DispTrace_event(DTRACE_DELAY, (uint16_t)((ms > 0xFFFF) ? 0xFFFF : ms));
+}
+
+/**************************************************************************/
+/*!
+    Values Returned by Bus Reads(e.g. device ID),then 0.
+*/
+/**************************************************************************/
+void DispTrace_set_read(const uint16_t* val, uint32_t n)
+{
+	dtrace_rdval = val;
+	dtrace_rdn	 = n;
+}
+
+uint16_t DispTrace_read(void)
+{
+	uint16_t v = 0;
+
+	if (dtrace_rdn) { v = *dtrace_rdval++; dtrace_rdn--; }
+	DispTrace_event(DTRACE_RD, v);
+
+	return v;
+}
+
+/**************************************************************************/
+/*!
+    Open Trace for Reading.
+*/
+/**************************************************************************/
+void DispTrace_open(DispTrace_Rd_t* rd, const uint8_t* trace, uint32_t len)
+{
+	memset(rd, 0, sizeof(*rd));
+	rd->p	= trace;
+	rd->end = trace + len;
+}
+
+/**************************************************************************/
+/*!
+    Get Next Event with Repeats Expanded,returns 0 at end.
+*/
+/**************************************************************************/
+int DispTrace_next(DispTrace_Rd_t* rd, DispTrace_Ev_t* ev)
+{
+	uint32_t val,shift;
+	uint8_t  tag;
+
+	while (!rd->left) {
+		if (rd->p >= rd->end) { ev->type = DTRACE_END; ev->val = 0; return 0; }
+
+		tag = *rd->p++;
+		val = shift = 0;
+		while (rd->p < rd->end) {
+			val |= (uint32_t)(*rd->p & 0x7F) << shift;
+			shift += 7;
+			if (!(*rd->p++ & 0x80)) break;
+		}
+
+		if (tag != DTRACE_REPEAT) {
+			ev->type = tag;
+			ev->val	 = (uint16_t)val;
+			memmove(&rd->hist[1], &rd->hist[0], sizeof(rd->hist) - sizeof(rd->hist[0]));
+			rd->hist[0] = *ev;
+			return 1;
+		}
+		rd->period = (uint8_t)((val & 7) + 1);
+		rd->left   = (val >> 3) * rd->period;
+	}
+
+	/* oldest of pattern becomes newest */
+	*ev = rd->hist[rd->period - 1];
+	memmove(&rd->hist[1], &rd->hist[0], sizeof(rd->hist) - sizeof(rd->hist[0]));
+	rd->hist[0] = *ev;
+	rd->left--;
+
+	return 1;
+}
+
+/**************************************************************************/
+/*!
+    Compare Two Traces Event by Event.
+	Returns -1 if same,else index of first different event(ea/eb set).
+*/
+/**************************************************************************/
+int32_t DispTrace_diff(const uint8_t* a, uint32_t alen, const uint8_t* b, uint32_t blen, DispTrace_Ev_t* ea, DispTrace_Ev_t* eb)
+{
+	DispTrace_Rd_t ra,rb;
+	int32_t i;
+	int na,nb;
+
+	DispTrace_open(&ra, a, alen);
+	DispTrace_open(&rb, b, blen);
+
+	for (i = 0; ; i++) {
+		na = DispTrace_next(&ra, ea);
+		nb = DispTrace_next(&rb, eb);
+		if (!na && !nb) return -1;
+		if ((ea->type != eb->type) || (ea->val != eb->val)) return i;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Init GRAM Model,window is whole GRAM.
+*/
+/**************************************************************************/
+void DispTrace_gram_init(DispTrace_Gram_t* m, uint16_t* gram, uint16_t width, uint16_t height, uint8_t style, uint8_t bus8)
+{
+	memset(m, 0, sizeof(*m));
+	m->gram	  = gram;
+	m->width  = width;
+	m->height = height;
+	m->style  = style;
+	m->bus8	  = bus8;
+	m->x1	  = width - 1;
+	m->y1	  = height - 1;
+}
+
+/**************************************************************************/
+/*!
+    GRAM Model,one pixel or register word.
+*/
+/**************************************************************************/
+static void DispTrace_gram_pixel(DispTrace_Gram_t* m, uint16_t pix)
+{
+	if ((m->x < m->width) && (m->y < m->height)) m->gram[(uint32_t)m->y * m->width + m->x] = pix;
+	m->pixels++;
+
+	if (m->x++ >= m->x1) {
+		m->x = m->x0;
+		if (m->y++ >= m->y1) m->y = m->y0;
+	}
+}
+
+static void DispTrace_gram_param(DispTrace_Gram_t* m, uint8_t v)
+{
+	switch (m->nparam++) {
+	case 0: if (m->reg == 0x2A) m->x0 = (uint16_t)(v << 8); else m->y0 = (uint16_t)(v << 8); break;
+	case 1: if (m->reg == 0x2A) m->x0 |= v; else m->y0 |= v; break;
+	case 2: if (m->reg == 0x2A) m->x1 = (uint16_t)(v << 8); else m->y1 = (uint16_t)(v << 8); break;
+	case 3: if (m->reg == 0x2A) m->x1 |= v; else m->y1 |= v; break;
+	default: break;
+	}
+}
+
+static void DispTrace_gram_reg(DispTrace_Gram_t* m, uint16_t v)
+{
+	switch (m->reg) {
+	case 0x20: m->x  = v; break;
+	case 0x21: m->y  = v; break;
+	case 0x50: m->x0 = v; break;
+	case 0x51: m->x1 = v; break;
+	case 0x52: m->y0 = v; break;
+	case 0x53: m->y1 = v; break;
+	default: break;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Feed Trace into GRAM Model,returns pixels written.
+	Start-byte serial protocols(e.g. ILI932x 3-wire SPI) are not decoded.
+*/
+/**************************************************************************/
+uint32_t DispTrace_gram(DispTrace_Gram_t* m, const uint8_t* trace, uint32_t len)
+{
+	DispTrace_Rd_t rd;
+	DispTrace_Ev_t ev;
+	uint32_t start = m->pixels;
+	uint16_t w;
+
+	DispTrace_open(&rd, trace, len);
+
+	while (DispTrace_next(&rd, &ev)) {
+		if (ev.type == DTRACE_CMD) {
+			m->half = 0;
+			m->nparam = 0;
+			if (m->style == DTRACE_DCS) {
+				m->reg = ev.val & 0xFF;
+				m->writing = (m->reg == 0x2C) || (m->reg == 0x3C);
+				if (m->reg == 0x2C) { m->x = m->x0; m->y = m->y0; }
+			}
+			else {
+				/* 8bit bus sends index in two transfers */
+				m->reg = m->bus8 ? (uint16_t)(m->reg << 8 | (ev.val & 0xFF)) : ev.val;
+				m->writing = (m->reg == 0x22);
+			}
+			continue;
+		}
+		if (ev.type != DTRACE_DAT) continue;
+
+		if ((m->style == DTRACE_DCS) && !m->writing) {
+			DispTrace_gram_param(m, (uint8_t)ev.val);
+			continue;
+		}
+
+		/* assemble word */
+		if (m->bus8) {
+			m->acc = (uint16_t)(m->acc << 8 | (ev.val & 0xFF));
+			m->half ^= 1;
+			if (m->half) continue;
+		}
+		w = m->bus8 ? m->acc : ev.val;
+
+		if (m->writing)	DispTrace_gram_pixel(m, w);
+		else			DispTrace_gram_reg(m, w);
+	}
+
+	return m->pixels - start;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,109 @@
+/********************************************************************************/
+/*!
+	@file			display_trace.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Bus Transaction Trace Recorder,Replayer and GRAM Model.	@n
+					For golden traces of driver init and drawing on the host.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Repeat period up to 8 events for CS framed SPI pixels.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_TRACE_H
+#define DISPLAY_TRACE_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* Trace Format
+   Each event is one tag byte(type) and a LEB128 value.
+   DTRACE_REPEAT value is period-1 in bits 2:0 and count in bits 31:3,
+   last period events are repeated count more times. */
+#define DTRACE_CMD			0			/* command/index transfer */
+#define DTRACE_DAT			1			/* data transfer */
+#define DTRACE_DELAY		2			/* _delay_ms() value */
+#define DTRACE_PIN			3			/* pin<<1 | level,changes only */
+#define DTRACE_RD			4			/* read,value returned */
+#define DTRACE_REPEAT		5
+#define DTRACE_END			0xFF		/* no more events */
+
+/* Pins */
+#define DTRACE_PIN_CS		0
+#define DTRACE_PIN_DC		1
+#define DTRACE_PIN_RES		2
+#define DTRACE_PIN_SCK		3
+#define DTRACE_PIN_SDI		4
+
+/* Longest repeated pattern(events),MUST be 8 or less */
+#ifndef DTRACE_MAX_PERIOD
+ #define DTRACE_MAX_PERIOD	8
+#endif
+
+/* Event */
+typedef struct {
+	uint8_t		type;
+	uint16_t	val;
+} DispTrace_Ev_t;
+
+/* Reader */
+typedef struct {
+	const uint8_t*	p;
+	const uint8_t*	end;
+	DispTrace_Ev_t	hist[DTRACE_MAX_PERIOD];	/* last events,[0] newest */
+	uint32_t		left;						/* events left in repeat */
+	uint8_t			period;
+} DispTrace_Rd_t;
+
+/* GRAM Model Styles */
+#define DTRACE_DCS			0			/* MIPI DCS 2Ah/2Bh/2Ch/3Ch */
+#define DTRACE_REG			1			/* index register R20h/21h/22h,R50h-53h */
+
+/* Host GRAM Model,pixels advance in x then y within the window */
+typedef struct {
+	uint16_t*	gram;				/* width*height native RGB565 */
+	uint16_t	width, height;
+	uint8_t		style;
+	uint8_t		bus8;				/* 1 = 8bit transfers(SPI,8bit i8080) */
+	/* state */
+	uint16_t	x0, x1, y0, y1, x, y;
+	uint16_t	reg;
+	uint16_t	acc;
+	uint8_t		half, nparam, writing;
+	uint32_t	pixels;
+} DispTrace_Gram_t;
+
+/* Recorder Functions Prototype */
+extern void DispTrace_begin(uint8_t* buf, uint32_t size);
+extern uint32_t DispTrace_end(void);
+extern void DispTrace_event(uint8_t type, uint16_t val);
+extern void DispTrace_pin(uint8_t pin, uint8_t level);
+extern void DispTrace_wr(uint8_t level);
+extern void DispTrace_spi(uint8_t dat);
+extern void DispTrace_delay(uint32_t ms);
+extern void DispTrace_set_read(const uint16_t* val, uint32_t n);
+extern uint16_t DispTrace_read(void);
+extern volatile uint16_t DispTrace_port;
+
+/* Replayer Functions Prototype */
+extern void DispTrace_open(DispTrace_Rd_t* rd, const uint8_t* trace, uint32_t len);
+extern int DispTrace_next(DispTrace_Rd_t* rd, DispTrace_Ev_t* ev);
+extern int32_t DispTrace_diff(const uint8_t* a, uint32_t alen, const uint8_t* b, uint32_t blen, DispTrace_Ev_t* ea, DispTrace_Ev_t* eb);
+extern void DispTrace_gram_init(DispTrace_Gram_t* m, uint16_t* gram, uint16_t width, uint16_t height, uint8_t style, uint8_t bus8);
+extern uint32_t DispTrace_gram(DispTrace_Gram_t* m, const uint8_t* trace, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_TRACE_H */
@@ -0,0 +1,198 @@
+/********************************************************************************/
+/*!
+	@file			display_video.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Raw RGB565 Video Streaming Player.						@n
+					Storage read and bus transfer overlap on line buffers.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Convert overlaps transfer,64bit fps.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_video.h"
+/* check header file version for fool proof */
+#if DISPLAY_VIDEO_H != 0x0200
+#error "header file version is not correspond!"
+#endif
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Variables -----------------------------------------------------------------*/
+DispVid_t DispVid;
+static uint8_t dvid_buf[DVID_BUFS][DVID_BUF_BYTES];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Function prototypes -------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Initialize Player.
+*/
+/**************************************************************************/
+void DispVid_init(const DispOps_t* ops, const DispVid_Src_t* src)
+{
+	memset(&DispVid, 0, sizeof(DispVid));
+	DispVid.ops = *ops;
+	DispVid.src = *src;
+	DispVid.period = 40;					/* 25fps */
+}
+
+/**************************************************************************/
+/*!
+    Set Playback Window / Frame Rate.
+*/
+/**************************************************************************/
+void DispVid_set_window(uint16_t x, uint16_t width, uint16_t y, uint16_t height)
+{
+	if (width - x + 1 > DVID_MAX_WIDTH) width = x + DVID_MAX_WIDTH - 1;
+
+	DispVid.x = x; DispVid.width  = width;
+	DispVid.y = y; DispVid.height = height;
+}
+
+void DispVid_set_fps(uint32_t fps)
+{
+	DispVid.period = fps ? (1000 + fps / 2) / fps : 0;
+}
+
+/**************************************************************************/
+/*!
+    Read One Chunk and Convert it in place.
+*/
+/**************************************************************************/
+static uint32_t DispVid_read(uint8_t* p, uint32_t bytes)
+{
+	bytes = bytes ? DispVid.src.read(DispVid.src.ctx, p, bytes) : 0;
+	if (bytes && DispVid.src.convert) DispVid.src.convert(p, bytes);
+
+	return bytes;
+}
+
+/**************************************************************************/
+/*!
+    Transfer Helpers.
+	Without async hooks the transfer is done in tx_start itself.
+*/
+/**************************************************************************/
+static inline void DispVid_tx_start(uint8_t* p, uint32_t bytes)
+{
+	if (DispVid.src.tx_start)	DispVid.src.tx_start(p, bytes);
+	else						DispOps_emit(&DispVid.ops, p, bytes);
+}
+
+static inline void DispVid_tx_wait(void)
+{
+	if (DispVid.src.tx_start) while (DispVid.src.tx_busy());
+}
+
+/**************************************************************************/
+/*!
+    Skip One Frame in the Stream.
+*/
+/**************************************************************************/
+static uint32_t DispVid_skip(uint32_t bytes)
+{
+	uint32_t k,n = 0;
+
+	if (DispVid.src.skip) {
+		DispVid.src.skip(DispVid.src.ctx, bytes);
+		return bytes;
+	}
+	while (n < bytes) {
+		k = bytes - n;
+		if (k > DVID_BUF_BYTES) k = DVID_BUF_BYTES;
+		k = DispVid.src.read(DispVid.src.ctx, dvid_buf[0], k);
+		if (!k) break;
+		n += k;
+	}
+
+	return n;
+}
+
+/**************************************************************************/
+/*!
+    Stream One Frame.
+	Chunk i is transferred while chunk i+1 is read and converted,so
+	frame time is bounded by the slowest stage,not their sum.
+*/
+/**************************************************************************/
+static uint32_t DispVid_frame(uint32_t bytes)
+{
+	uint32_t chunk = (uint32_t)(DispVid.width - DispVid.x + 1) * 2 * DVID_LINES;
+	uint32_t done = 0;
+	uint32_t cur,nxt;
+	uint8_t  sel = 0;
+
+	DispVid.ops.rect(DispVid.x, DispVid.width, DispVid.y, DispVid.height);
+
+	cur = DispVid_read(dvid_buf[0], (bytes < chunk) ? bytes : chunk);
+
+	while (cur) {
+		DispVid_tx_start(dvid_buf[sel], cur);
+		done += cur;
+
+		sel = (uint8_t)((sel + 1) % DVID_BUFS);
+		nxt = bytes - done;
+		if (nxt > chunk) nxt = chunk;
+		nxt = DispVid_read(dvid_buf[sel], nxt);
+
+		DispVid_tx_wait();
+		cur = nxt;
+	}
+
+	return done;
+}
+
+/**************************************************************************/
+/*!
+    Play Stream.
+	Frames are paced on DVID_CLOCK(),a frame later than one period is
+	skipped in the stream and counted as dropped.
+	nframes = 0 plays until end of stream.
+	Returns frames shown.
+*/
+/**************************************************************************/
+uint32_t DispVid_play(uint32_t nframes)
+{
+	uint32_t bytes = (uint32_t)(DispVid.width - DispVid.x + 1) * (DispVid.height - DispVid.y + 1) * 2;
+	uint32_t t0 = DVID_CLOCK();
+	uint32_t due = t0;
+	uint32_t n;
+
+	DispVid.frames	= 0;
+	DispVid.dropped	= 0;
+
+	for (n = 0; !nframes || (n < nframes); n++, due += DispVid.period) {
+		/* late by one period or more,drop this frame */
+		if (DispVid.period && ((int32_t)(DVID_CLOCK() - due) >= (int32_t)DispVid.period)) {
+			if (DispVid_skip(bytes) < bytes) break;
+			DispVid.dropped++;
+			continue;
+		}
+		while ((int32_t)(DVID_CLOCK() - due) < 0);
+
+		if (DispVid.src.te_wait) DispVid.src.te_wait();
+
+		if (DispVid_frame(bytes) < bytes) break;
+		DispVid.frames++;
+	}
+
+	DispVid.elapsed  = DVID_CLOCK() - t0;
+	DispVid.fps_x100 = DispVid.elapsed ? (uint32_t)(((uint64_t)DispVid.frames * 100000) / DispVid.elapsed) : 0;
+
+	return DispVid.frames;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,85 @@
+/********************************************************************************/
+/*!
+	@file			display_video.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Raw RGB565 Video Streaming Player.						@n
+					Storage read and bus transfer overlap on line buffers.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Convert overlaps transfer,64bit fps.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_VIDEO_H
+#define DISPLAY_VIDEO_H 0x0200
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_ops.h"
+
+/* Line Buffer Ring */
+#ifndef DVID_MAX_WIDTH
+ #define DVID_MAX_WIDTH		320
+#endif
+#ifndef DVID_LINES
+ #define DVID_LINES			8			/* lines per buffer */
+#endif
+#ifndef DVID_BUFS
+ #define DVID_BUFS			2			/* >= 2 */
+#endif
+#define DVID_BUF_BYTES		(DVID_MAX_WIDTH*2*DVID_LINES)
+
+/* Pacing clock(ms),override for host build */
+#ifndef DVID_CLOCK
+ #define DVID_CLOCK()		ticktime
+ extern volatile uint32_t ticktime;
+#endif
+
+/* Stream Source and Sink Hooks */
+typedef struct {
+	uint32_t (*read)(void* ctx, uint8_t* dst, uint32_t bytes);	/* returns bytes read,short = end */
+	void	 (*skip)(void* ctx, uint32_t bytes);				/* optional,seek forward for drop */
+	void*	 ctx;
+	void	 (*convert)(uint8_t* p, uint32_t bytes);			/* optional,in-place pixel convert */
+	void	 (*tx_start)(uint8_t* p, uint32_t bytes);			/* optional async DMA,NULL = ops.wr_block */
+	int		 (*tx_busy)(void);									/* with tx_start */
+	void	 (*te_wait)(void);									/* optional,wait Tearing Effect */
+} DispVid_Src_t;
+
+/* Player State */
+typedef struct {
+	DispOps_t		ops;
+	DispVid_Src_t	src;
+	uint16_t		x, width, y, height;	/* END point manner */
+	uint32_t		period;					/* ms per frame */
+	uint32_t		frames;					/* shown */
+	uint32_t		dropped;
+	uint32_t		elapsed;				/* ms */
+	uint32_t		fps_x100;				/* achieved frame rate x100 */
+} DispVid_t;
+
+extern DispVid_t DispVid;
+
+/* Video Player Functions Prototype */
+extern void DispVid_init(const DispOps_t* ops, const DispVid_Src_t* src);
+extern void DispVid_set_window(uint16_t x, uint16_t width, uint16_t y, uint16_t height);
+extern void DispVid_set_fps(uint32_t fps);
+extern uint32_t DispVid_play(uint32_t nframes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_VIDEO_H */
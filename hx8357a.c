@@ -2,8 +2,8 @@
 /*!
 	@file			hx8357a.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive TFT1N3277-E TFT module(8/16bit mode).
 
@@ -11,6 +11,8 @@
 		2012.06.30	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added partial/idle low-power mode.
+		2026.10.19	V5.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -20,13 +22,17 @@
 /* Includes ------------------------------------------------------------------*/
 #include "hx8357a.h"
 /* check header file version for fool proof */
-#if HX8357A_H != 0x0300
+#if HX8357A_H != 0x0500
 #error "header file version is not correspond!"
 #endif
 
 /* Defines -------------------------------------------------------------------*/
 
 /* Variables -----------------------------------------------------------------*/
+/* Display Mode */
+uint8_t HX8357A_mode = HX8357A_MODE_NORMAL;
+/* Sleep/Wake State */
+static uint8_t  hx8357a_asleep;
 
 /* Constants -----------------------------------------------------------------*/
 
@@ -202,6 +208,111 @@ inline void HX8357A_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Enter Partial and Idle(8 colours) Mode.
+	top/bottom are panel rows at rotation 0,rows outside are not driven.
+	Called again in this mode,only the area is moved.
+*/
+/**************************************************************************/
+void HX8357A_partial_idle(uint16_t top, uint16_t bottom)
+{
+	HX8357A_wr_cmd(0x0A);				/* Partial Area Start Row ADDR2 */
+	HX8357A_wr_dat((OFS_RAW + top)>>8);
+	HX8357A_wr_cmd(0x0B);				/* Partial Area Start Row ADDR1 */
+	HX8357A_wr_dat(OFS_RAW + top);
+	HX8357A_wr_cmd(0x0C);				/* Partial Area End Row ADDR2 */
+	HX8357A_wr_dat((OFS_RAW + bottom)>>8);
+	HX8357A_wr_cmd(0x0D);				/* Partial Area End Row ADDR1 */
+	HX8357A_wr_dat(OFS_RAW + bottom);
+
+	if (HX8357A_mode == HX8357A_MODE_PARTIAL_IDLE) return;
+
+	HX8357A_wr_cmd(0x01);				/* Display Mode Control */
+	HX8357A_wr_dat(0x09);				/* IDMON=1,PTLON=1 */
+
+	HX8357A_mode = HX8357A_MODE_PARTIAL_IDLE;
+}
+
+/**************************************************************************/
+/*! 
+    Back to Normal Mode without Re-initialize.
+*/
+/**************************************************************************/
+void HX8357A_normal(void)
+{
+	if (HX8357A_mode == HX8357A_MODE_NORMAL) return;
+
+	HX8357A_wr_cmd(0x01);				/* Display Mode Control */
+	HX8357A_wr_dat(0x00);				/* as initialized */
+
+	HX8357A_mode = HX8357A_MODE_NORMAL;
+}
+
+/**************************************************************************/
+/*! 
+    Enter Standby Mode,GRAM and registers are kept.
+*/
+/**************************************************************************/
+void HX8357A_sleep(void)
+{
+	if (hx8357a_asleep) return;
+
+	HX8357A_wr_cmd(0x28);				/* Display Control 3 */
+	HX8357A_wr_dat(0x38);				/* GON=1,DTE=1,D=10 */
+	_delay_ms(40);						/* wait 2 frames */
+	HX8357A_wr_cmd(0x28);
+	HX8357A_wr_dat(0x04);				/* GON=0,DTE=0,D=01:display off */
+
+	HX8357A_wr_cmd(0x1F);				/* Power Control 6 */
+	HX8357A_wr_dat(0x90);				/* VCOMG=0 */
+	_delay_ms(5);
+	HX8357A_wr_cmd(0x1F);
+	HX8357A_wr_dat(0x88);				/* PON=0,DK=1 */
+	HX8357A_wr_cmd(0x1F);
+	HX8357A_wr_dat(0x89);				/* STB=1 */
+
+	hx8357a_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Standby Mode without Re-initialize.
+*/
+/**************************************************************************/
+void HX8357A_wake(void)
+{
+	if (!hx8357a_asleep) return;
+
+	HX8357A_wr_cmd(0x1F);				/* Power Control 6 */
+	HX8357A_wr_dat(0x88);				/* STB=0 */
+	_delay_ms(5);
+
+	/* power on as initialized */
+	HX8357A_wr_cmd(0x1F);
+	HX8357A_wr_dat(0x80);
+	_delay_ms(5);
+	HX8357A_wr_cmd(0x1F);
+	HX8357A_wr_dat(0x90);
+	_delay_ms(5);
+	HX8357A_wr_cmd(0x1F);
+	HX8357A_wr_dat(0xD4);
+	_delay_ms(5);
+
+	/* display on as initialized */
+	HX8357A_wr_cmd(0x28);				/* Display Control 3 */
+	HX8357A_wr_dat(0x08);
+	_delay_ms(40);
+	HX8357A_wr_cmd(0x28);
+	HX8357A_wr_dat(0x38);
+	_delay_ms(40);
+	HX8357A_wr_cmd(0x28);
+	HX8357A_wr_dat(0x3C);
+
+	hx8357a_asleep = 0;
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -372,6 +483,9 @@ void HX8357A_init(void)
 
 	else { for(;;);}					/* Invalid Device Code!! */
 
+	HX8357A_mode = HX8357A_MODE_NORMAL;
+	hx8357a_asleep = 0;
+
 	HX8357A_clear();
 
 #if 0	/* test code RED */
@@ -2,8 +2,8 @@
 /*!
 	@file			hx8357a.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive TFT1N3277-E TFT module(8/16bit mode).
 
@@ -11,13 +11,15 @@
 		2012.06.30	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added partial/idle low-power mode.
+		2026.10.19	V5.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef HX8357A_H
-#define HX8357A_H 0x0300
+#define HX8357A_H 0x0500
 
 #ifdef __cplusplus
  extern "C" {
@@ -59,9 +61,18 @@
 #define	HX8357A_DATA		DISPLAY_DATAPORT
 #define HX8357A_CMD			DISPLAY_CMDPORT
 
+/* Display Mode */
+#define HX8357A_MODE_NORMAL			0
+#define HX8357A_MODE_PARTIAL_IDLE	1
+
 /* Display Control Functions Prototype */
 extern void HX8357A_reset(void);
 extern void HX8357A_init(void);
+extern void HX8357A_partial_idle(uint16_t top, uint16_t bottom);
+extern void HX8357A_normal(void);
+extern void HX8357A_sleep(void);
+extern void HX8357A_wake(void);
+extern uint8_t HX8357A_mode;
 extern void HX8357A_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void HX8357A_wr_cmd(uint8_t cmd);
 extern void HX8357A_wr_dat(uint8_t dat);
@@ -81,6 +92,11 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		HX8357A_wr_cmd
 #define Display_wr_block_if		HX8357A_wr_block
 #define Display_clear_if 		HX8357A_clear
+#define Display_partial_idle_if	HX8357A_partial_idle
+#define Display_normal_if		HX8357A_normal
+#define Display_sleep_if		HX8357A_sleep
+#define Display_wake_if			HX8357A_wake
+#define Display_mode_if			HX8357A_mode
 
 #ifdef __cplusplus
 }
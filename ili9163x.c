@@ -2,8 +2,8 @@
 /*!
 	@file			ili9163x.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        6.00
-    @date           2023.08.01
+    @version        9.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -SGP18T-00		(ILI9163B)	4-Wire,8-bitSerial.				@n
@@ -18,6 +18,9 @@
 		2012.08.31  V4.00	Added S93160 Module Support.
 		2023.05.01	V5.00	Removed unused delay function.
 		2023.08.01	V6.00	Revised release.
+		2026.10.19	V7.00	Added runtime rotation and column-major block write.
+		2026.10.19	V8.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V9.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -27,7 +30,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ili9163x.h"
 /* check header file version for fool proof */
-#if ILI9163X_H != 0x0600
+#if ILI9163X_H != 0x0900
 #error "header file version is not correspond!"
 #endif
 
@@ -45,6 +48,12 @@
 #endif
 
 /* Variables -----------------------------------------------------------------*/
+/* Runtime Rotation State */
+static uint8_t ili9163x_madctl  = MADVAL;
+static uint8_t ili9163x_ofs_col = OFS_COL;
+static uint8_t ili9163x_ofs_raw = OFS_RAW;
+uint16_t ILI9163x_max_x = MAX_X;
+uint16_t ILI9163x_max_y = MAX_Y;
 
 /* Constants -----------------------------------------------------------------*/
 
@@ -347,16 +356,16 @@ inline void ILI9163x_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t heigh
 	/* Set CAS Address */
 	ILI9163x_wr_cmd(CASET); 
 	ILI9163x_wr_dat(0);
-	ILI9163x_wr_dat(OFS_COL + x);
+	ILI9163x_wr_dat(ili9163x_ofs_col + x);
 	ILI9163x_wr_dat(0);
-	ILI9163x_wr_dat(OFS_COL + width);
+	ILI9163x_wr_dat(ili9163x_ofs_col + width);
 	
 	/* Set RAS Address */
 	ILI9163x_wr_cmd(RASET);
 	ILI9163x_wr_dat(0);
-	ILI9163x_wr_dat(OFS_RAW + y); 
+	ILI9163x_wr_dat(ili9163x_ofs_raw + y); 
 	ILI9163x_wr_dat(0);
-	ILI9163x_wr_dat(OFS_RAW + height); 
+	ILI9163x_wr_dat(ili9163x_ofs_raw + height); 
 	
 	/* Write RAM */
 	ILI9163x_wr_cmd(RAMWR);
@@ -371,7 +380,7 @@ inline void ILI9163x_clear(void)
 {
 	volatile uint32_t n;
 
-	ILI9163x_rect(0,MAX_X-1,0,MAX_Y-1);
+	ILI9163x_rect(0,ILI9163x_max_x-1,0,ILI9163x_max_y-1);
 	n = (MAX_X) * (MAX_Y);
 
 	do {
@@ -381,6 +390,89 @@ inline void ILI9163x_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Set Display Rotation(0/90/180/270 degree).
+*/
+/**************************************************************************/
+void ILI9163x_set_rotation(uint16_t deg)
+{
+	static const uint8_t madrot[4] = { 0, MADCTL_MV|MADCTL_MX, MADCTL_MX|MADCTL_MY, MADCTL_MV|MADCTL_MY };
+	uint8_t r = (uint8_t)((deg / 90) & 3);
+
+	ili9163x_madctl = MADVAL ^ madrot[r];
+	ILI9163x_wr_cmd(MADCTL);
+	ILI9163x_wr_dat(ili9163x_madctl);
+
+	if (r & 1) {
+		ILI9163x_max_x   = MAX_Y;
+		ILI9163x_max_y   = MAX_X;
+		ili9163x_ofs_col = OFS_RAW;
+		ili9163x_ofs_raw = OFS_COL;
+	}
+	else {
+		ILI9163x_max_x   = MAX_X;
+		ILI9163x_max_y   = MAX_Y;
+		ili9163x_ofs_col = OFS_COL;
+		ili9163x_ofs_raw = OFS_RAW;
+	}
+}
+
+/**************************************************************************/
+/*! 
+    Write Column-Major Block Data.
+	Exchange Row/Column(MV) only while this blit,no transpose needed.
+*/
+/**************************************************************************/
+void ILI9163x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt)
+{
+	uint8_t ofs;
+
+	ILI9163x_wr_cmd(MADCTL);
+	ILI9163x_wr_dat(ili9163x_madctl ^ MADCTL_MV);
+
+	ofs = ili9163x_ofs_col; ili9163x_ofs_col = ili9163x_ofs_raw; ili9163x_ofs_raw = ofs;
+	ILI9163x_rect(y,height,x,width);
+	ofs = ili9163x_ofs_col; ili9163x_ofs_col = ili9163x_ofs_raw; ili9163x_ofs_raw = ofs;
+
+	ILI9163x_wr_block(p,cnt);
+
+	ILI9163x_wr_cmd(MADCTL);
+	ILI9163x_wr_dat(ili9163x_madctl);
+}
+
+
+/**************************************************************************/
+/*! 
+    Set Interface Pixel Format for Following GRAM Data.
+	Used by PixFmt_blit(),returns 0 on success,-1 if not supported.
+*/
+/**************************************************************************/
+int ILI9163x_set_pixfmt(uint8_t fmt)
+{
+	uint8_t colmod;
+
+	switch (fmt) {
+	case PIXFMT_RGB565:
+		colmod = 0x05;				/* 16-bit/pixel R5G6B5 */
+		break;
+	case PIXFMT_RGB444:
+		colmod = 0x03;				/* 12-bit/pixel R4G4B4 */
+		break;
+	case PIXFMT_RGB666:
+		colmod = 0x06;				/* 18-bit/pixel R6G6B6 */
+		break;
+	default:
+		return -1;					/* ILI9163x has no 8bit/pixel interface format */
+	}
+
+	ILI9163x_wr_cmd(COLMOD);				/* Interface Pixel Format */
+	ILI9163x_wr_dat(colmod);
+
+	return 0;
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -485,6 +577,8 @@ void ILI9163x_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+	ILI9163x_set_rotation(ILI9163X_ROTATION);
+
 	ILI9163x_clear();
 
 #if 0	/* test code RED */
@@ -2,8 +2,8 @@
 /*!
 	@file			ili9163x.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        6.00
-    @date           2023.08.01
+    @version        9.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -SGP18T-00		(ILI9163B)	4-Wire,8-bitSerial.				@n
@@ -18,13 +18,16 @@
 		2012.08.31  V4.00	Added S93160 Module Support.
 		2023.05.01	V5.00	Removed unused delay function.
 		2023.08.01	V6.00	Revised release.
+		2026.10.19	V7.00	Added runtime rotation and column-major block write.
+		2026.10.19	V8.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V9.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ILI9163X_H
-#define ILI9163X_H 0x0600
+#define ILI9163X_H 0x0900
 
 #ifdef __cplusplus
  extern "C" {
@@ -36,6 +39,7 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#include "display_pixfmt.h"
 
 /* Module Driver Configure */
 /* U MUST select one from those modules */
@@ -224,6 +228,19 @@
 #define VCOM4L		(0xFF)
 
 
+/* MADCTL Bits */
+#define MADCTL_MY	(1<<7)
+#define MADCTL_MX	(1<<6)
+#define MADCTL_MV	(1<<5)
+#define MADCTL_ML	(1<<4)
+#define MADCTL_BGR	(1<<3)
+#define MADCTL_MH	(1<<2)
+
+/* Default Rotation after Initialize (0/90/180/270) */
+#ifndef ILI9163X_ROTATION
+ #define ILI9163X_ROTATION	0
+#endif
+
 /* Display Control Functions Prototype */
 extern void ILI9163x_reset(void);
 extern void ILI9163x_init(void);
@@ -234,6 +251,11 @@ extern void ILI9163x_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ILI9163x_clear(void);
 extern void ILI9163x_wr_gram(uint16_t gram);
 extern uint8_t ILI9163x_rd_cmd(uint8_t cmd);
+extern void ILI9163x_set_rotation(uint16_t deg);
+extern void ILI9163x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt);
+extern uint16_t ILI9163x_max_x;
+extern uint16_t ILI9163x_max_y;
+extern int ILI9163x_set_pixfmt(uint8_t fmt);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -246,6 +268,12 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ILI9163x_wr_cmd
 #define Display_wr_block_if		ILI9163x_wr_block
 #define Display_clear_if 		ILI9163x_clear
+#define Display_set_pixfmt_if		ILI9163x_set_pixfmt
+#define Display_wr_byte_if		ILI9163x_wr_dat
+#define Display_set_rotation_if		ILI9163x_set_rotation
+#define Display_wr_block_colmajor_if	ILI9163x_wr_block_colmajor
+#define Display_max_x_if		ILI9163x_max_x
+#define Display_max_y_if		ILI9163x_max_y
 
 #ifdef __cplusplus
 }
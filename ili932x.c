@@ -2,8 +2,8 @@
 /*!
 	@file			ili932x.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        16.00
-    @date           2023.08.01
+    @version        20.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -YHY024006A				(ILI9325)	8/16bit mode.		@n
@@ -50,6 +50,10 @@
 		2014.10.15 V14.00	Fixed 8-bit access bug.
 		2023.05.01 V15.00	Removed unused delay function.
 		2023.08.01 V16.00	Revised release.
+		2026.10.19 V17.00	Single Start-Byte GRAM burst in SPI clear.
+		2026.10.19 V18.00	Added runtime rotation and column-major block write.
+		2026.10.19 V19.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V20.00	Added frame rate levels for adaptive refresh.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -59,7 +63,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ili932x.h"
 /* check header file version for fool proof */
-#if ILI932X_H != 0x1600
+#if ILI932X_H != 0x2000
 #error "header file version is not correspond!"
 #endif
 
@@ -82,8 +86,25 @@
 #endif
 
 /* Variables -----------------------------------------------------------------*/
+#if defined(USE_ILI932x_SPI_TFT) && defined(USE_DISPLAY_DMA_TRANSFER)
+/* One GRAM line for DMA burst fill */
+static uint8_t ili932x_linebuf[MAX_X*2];
+#endif
+/* Runtime Rotation State */
+static uint16_t ili932x_entry = ENTRY_ID1|ENTRY_ID0;	/* Entry Mode at rotation 0 */
+static uint8_t  ili932x_rot;
+uint16_t ILI932x_max_x = MAX_X;
+uint16_t ILI932x_max_y = MAX_Y;
+/* Sleep/Wake State,R07h/R10h read back at sleep */
+static uint8_t  ili932x_asleep;
+static uint16_t ili932x_r07,ili932x_r10;
+/* R2Bh holds frame rate on this device */
+static uint8_t  ili932x_frs;
 
 /* Constants -----------------------------------------------------------------*/
+/* Frame Rate Levels,FRS of R2Bh */
+static const uint8_t ili932x_frc[ILI932x_FRAME_RATES] = { 0x0, 0x4, 0x8, 0xB, 0xD };
+const uint8_t ILI932x_frame_rate_hz[ILI932x_FRAME_RATES] = { 40, 51, 70, 96, 128 };
 
 /* Function prototypes -------------------------------------------------------*/
 
@@ -348,20 +369,45 @@ inline  uint16_t ILI932x_rd_cmd(uint8_t cmd)
 /**************************************************************************/
 inline void ILI932x_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
 {
+	uint32_t hs,he,vs,ve,ax,ay;
+
+	/* Map logical window onto physical GRAM,start point follows I/D bits */
+	switch (ili932x_rot) {
+	case 1:		/* 90 degree */
+		hs = (MAX_X-1) - height;	he = (MAX_X-1) - y;
+		vs = x;						ve = width;
+		ax = he;					ay = vs;
+		break;
+	case 2:		/* 180 degree */
+		hs = (MAX_X-1) - width;		he = (MAX_X-1) - x;
+		vs = (MAX_Y-1) - height;	ve = (MAX_Y-1) - y;
+		ax = he;					ay = ve;
+		break;
+	case 3:		/* 270 degree */
+		hs = y;						he = height;
+		vs = (MAX_Y-1) - width;		ve = (MAX_Y-1) - x;
+		ax = hs;					ay = ve;
+		break;
+	default:	/* 0 degree */
+		hs = x;						he = width;
+		vs = y;						ve = height;
+		ax = hs;					ay = vs;
+		break;
+	}
 
 	ILI932x_wr_cmd(0x50);				/* Horizontal RAM Start ADDR */
-	ILI932x_wr_dat(OFS_COL + x);
+	ILI932x_wr_dat(OFS_COL + hs);
 	ILI932x_wr_cmd(0x51);				/* Horizontal RAM End ADDR */
-	ILI932x_wr_dat(OFS_COL + width);
+	ILI932x_wr_dat(OFS_COL + he);
 	ILI932x_wr_cmd(0x52);				/* Vertical RAM Start ADDR */
-	ILI932x_wr_dat(OFS_RAW + y);
+	ILI932x_wr_dat(OFS_RAW + vs);
 	ILI932x_wr_cmd(0x53);				/* Vertical End ADDR */
-	ILI932x_wr_dat(OFS_RAW + height);
+	ILI932x_wr_dat(OFS_RAW + ve);
 
 	ILI932x_wr_cmd(0x20);				/* GRAM Vertical/Horizontal ADDR Set(AD0~AD7) */
-	ILI932x_wr_dat(OFS_COL + x);
+	ILI932x_wr_dat(OFS_COL + ax);
 	ILI932x_wr_cmd(0x21);				/* GRAM Vertical/Horizontal ADDR Set(AD8~AD16) */
-	ILI932x_wr_dat(OFS_RAW + y);
+	ILI932x_wr_dat(OFS_RAW + ay);
 
 	ILI932x_wr_cmd(0x22);				/* Write Data to GRAM */
 
@@ -376,13 +422,147 @@ inline void ILI932x_clear(void)
 {
 	volatile uint32_t n;
 
-	ILI932x_rect(0,MAX_X-1,0,MAX_Y-1);
+	ILI932x_rect(0,ILI932x_max_x-1,0,ILI932x_max_y-1);
+
+#ifdef USE_ILI932x_SPI_TFT
+	DISPLAY_ASSART_CS();						/* CS=L		     */
+#if !defined(ILI9325_SPI_4WIREMODE)
+	SendSPI(START_WR_DATA);						/* Start Byte once per window */
+#endif
+
+#ifdef  USE_DISPLAY_DMA_TRANSFER
+	for (n = 0; n < sizeof(ili932x_linebuf); n += 2) {
+		ili932x_linebuf[n]   = (uint8_t)(COL_BLACK>>8);
+		ili932x_linebuf[n+1] = (uint8_t)COL_BLACK;
+	}
+	n = MAX_Y;
+
+	do {
+		DMA_TRANSACTION(ili932x_linebuf, sizeof(ili932x_linebuf));
+	} while (--n);
+#else
+	n = (uint32_t)(MAX_X) * (MAX_Y);
+
+	do {
+		SendSPI16(COL_BLACK);
+	} while (--n);
+#endif
+
+	DISPLAY_NEGATE_CS();						/* CS=H		     */
+#else
 	n = (uint32_t)(MAX_X) * (MAX_Y);
 
 	do {
 		ILI932x_wr_dat(COL_BLACK);
 	} while (--n);
+#endif
+
+}
+
+
+/**************************************************************************/
+/*! 
+    Set Entry Mode for Current Rotation.
+*/
+/**************************************************************************/
+static void ILI932x_wr_entry(uint16_t am)
+{
+	static const uint16_t entrot[4] = { ENTRY_ID1|ENTRY_ID0, ENTRY_ID1|ENTRY_AM, 0, ENTRY_ID0|ENTRY_AM };
+
+	ILI932x_wr_cmd(0x03);				/* Entry Mode */
+	ILI932x_wr_dat((ili932x_entry & ~(ENTRY_ID1|ENTRY_ID0|ENTRY_AM)) | (entrot[ili932x_rot] ^ am));
+}
+
+/**************************************************************************/
+/*! 
+    Set Display Rotation(0/90/180/270 degree).
+*/
+/**************************************************************************/
+void ILI932x_set_rotation(uint16_t deg)
+{
+	ili932x_rot = (uint8_t)((deg / 90) & 3);
+	ILI932x_wr_entry(0);
 
+	if (ili932x_rot & 1) {
+		ILI932x_max_x = MAX_Y;
+		ILI932x_max_y = MAX_X;
+	}
+	else {
+		ILI932x_max_x = MAX_X;
+		ILI932x_max_y = MAX_Y;
+	}
+}
+
+/**************************************************************************/
+/*! 
+    Write Column-Major Block Data.
+	Toggle AM only while this blit,no transpose needed.
+*/
+/**************************************************************************/
+void ILI932x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt)
+{
+	ILI932x_wr_entry(ENTRY_AM);
+	ILI932x_rect(x,width,y,height);
+	ILI932x_wr_block(p,cnt);
+	ILI932x_wr_entry(0);
+}
+
+/**************************************************************************/
+/*! 
+    Enter Sleep Mode(R10h SLP=1),GRAM and registers are kept.
+	Gate outputs are turned off first by Display Control 1.
+*/
+/**************************************************************************/
+void ILI932x_sleep(void)
+{
+	if (ili932x_asleep) return;
+
+	ili932x_r07 = ILI932x_rd_cmd(0x07);
+	ili932x_r10 = ILI932x_rd_cmd(0x10) & ~0x0003;
+
+	ILI932x_wr_cmd(0x07);						/* Display Control 1 */
+	ILI932x_wr_dat(ili932x_r07 & ~0x0002);		/* D1=0:display off */
+	_delay_ms(20);								/* wait 1 frame or more */
+	ILI932x_wr_cmd(0x07);
+	ILI932x_wr_dat(0x0000);						/* GON=0,DTE=0,D=00 */
+
+	ILI932x_wr_cmd(0x10);						/* Power Control 1 */
+	ILI932x_wr_dat(ili932x_r10 | 0x0002);		/* SLP=1 */
+
+	ili932x_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Sleep Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ILI932x_wake(void)
+{
+	if (!ili932x_asleep) return;
+
+	ILI932x_wr_cmd(0x10);						/* Power Control 1 */
+	ILI932x_wr_dat(ili932x_r10);				/* SLP=0 */
+	_delay_ms(30);								/* wait step-up circuits,2 frames */
+
+	ILI932x_wr_cmd(0x07);						/* Display Control 1 */
+	ILI932x_wr_dat(ili932x_r07);				/* display on as before */
+
+	ili932x_asleep = 0;
+}
+
+/**************************************************************************/
+/*! 
+    Set Frame Rate Level in Normal Mode,0 = slowest.
+*/
+/**************************************************************************/
+void ILI932x_set_frame_rate(uint8_t level)
+{
+	if (!ili932x_frs) return;					/* R2Bh is not frame rate */
+	if (level >= ILI932x_FRAME_RATES) level = ILI932x_FRAME_RATES - 1;
+
+	ILI932x_wr_cmd(0x2B);						/* Frame Rate and Color Control */
+	ILI932x_wr_dat(ili932x_frc[level]);
 }
 
 
@@ -401,6 +581,8 @@ void ILI932x_init(void)
 
 	/* Check Device Code */
 	devicetype = ILI932x_rd_cmd(0x0000);  			/* Confirm Vaild LCD Controller */
+	ili932x_frs = (devicetype == 0x9325) || (devicetype == 0x5408) || (devicetype == 0x6809) ||
+				  (devicetype == 0x6807) || (devicetype == 0x9328) || (devicetype == 0x9331);
 
 	if((devicetype == 0x9325) || (devicetype == 0x5408) || (devicetype == 0x6809) || (devicetype == 0x6807))
 	{
@@ -416,8 +598,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);						/* Set 1 line inversion */ 
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<9)|(0<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<9)|(0<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x04);						/* Scalling Control */ 
 		ILI932x_wr_dat(0x0000);
 		ILI932x_wr_cmd(0x08);						/* Display Control 2(0x0207) */ 
@@ -538,8 +721,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);						/* Driver Waveform Control Set 1 line inversion */ 
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Entry Mode Set  Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		/* ILI932x_wr_dat((1<<15)|(1<<7)|(1<<4)|(1<<5)|(1<<12)); */ /* 262k colour */
 		/* ILI932x_wr_dat(0x1018); */				/* original */
 		
@@ -719,8 +903,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Entry Mode Set  Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08);
 		ILI932x_wr_dat(0x0808);
 		ILI932x_wr_cmd(0x09);
@@ -821,8 +1006,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);	
 		ILI932x_wr_cmd(0x02); 
 		ILI932x_wr_dat(0x0300);
+		ili932x_entry = (1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03); 
-		ILI932x_wr_dat((1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08); 
 		ILI932x_wr_dat(0x0202);
 		ILI932x_wr_cmd(0x0A); 
@@ -887,8 +1073,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02); 						/* set 1 line inversion 		  */
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<7)|(1<<5)|(1<<4);/* ILI932x_wr_dat(0x1030); *//* original */
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<7)|(1<<5)|(1<<4));/* ILI932x_wr_dat(0x1030); *//* original */
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x04);						/* Resize register				  */
 		ILI932x_wr_dat(0x0000);	
 		ILI932x_wr_cmd(0x08); 						/* set the back porch and front porch */
@@ -1000,8 +1187,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);						/* line inversion */
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<7)|(1<<5)|(1<<4);//0x1030
 		ILI932x_wr_cmd(0x03);						/* entry mode (65K,write ram direction ,BGR) */
-		ILI932x_wr_dat((1<<12)|(1<<7)|(1<<5)|(1<<4));//0x1030
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08);						/* Front porch=3,Back porch=2 */
 		ILI932x_wr_dat(0x0302);
 		ILI932x_wr_cmd(0x09);						/* scan cycle */
@@ -1130,8 +1318,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);						/* BC0=1--Line inversion */
 		ILI932x_wr_dat(0x0200);
+		ili932x_entry = (1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4); // 0x1030 is original */
 		ILI932x_wr_cmd(0x03);
-		ILI932x_wr_dat((1<<12)|(1<<9)|(1<<7)|(1<<5)|(1<<4)); // 0x1030 is original */
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x09);
 		ILI932x_wr_dat(0x0001);
 		ILI932x_wr_cmd(0x0A);
@@ -1213,8 +1402,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);
 		ILI932x_wr_dat(0x0300);
+		ili932x_entry = (1<<12)|(0<<9)|(1<<7)|(1<<5)|(1<<4); 
 		ILI932x_wr_cmd(0x03);
-		ILI932x_wr_dat((1<<12)|(0<<9)|(1<<7)|(1<<5)|(1<<4)); 
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08);
 		ILI932x_wr_dat(0x0808);
 		ILI932x_wr_cmd(0x0A);
@@ -1257,8 +1447,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat((0<<10)|(1<<8));
 		ILI932x_wr_cmd(0x02);
 		ILI932x_wr_dat(0x0200);						/* set 1 line inversion */
+		ili932x_entry = (1<<12)|(1<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08);						/* display control2 porch 2line */ 
 		ILI932x_wr_dat(0x0202);
 		ILI932x_wr_cmd(0x09);
@@ -1403,8 +1594,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat((0<<10)|(1<<8));
 		ILI932x_wr_cmd(0x02);
 		ILI932x_wr_dat(0x0200);						/* set 1 line inversion */
+		ili932x_entry = (1<<12)|(1<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		
 		ILI932x_wr_cmd(0x09);
 		ILI932x_wr_dat(0x0001);
@@ -1508,8 +1700,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(0<<9)|(0<<7)|(1<<5)|(1<<4)|(0<<3);
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(0<<9)|(0<<7)|(1<<5)|(1<<4)|(0<<3));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x61);
 		ILI932x_wr_dat(0x0007);
 		ILI932x_wr_cmd(0x90);
@@ -1549,8 +1742,9 @@ void ILI932x_init(void)
 		ILI932x_wr_dat(0x0100);
 		ILI932x_wr_cmd(0x02);						/* Driver Waveform Control Set 1 line inversion */ 
 		ILI932x_wr_dat(0x0700);
+		ili932x_entry = (1<<12)|(1<<9)|(0<<7)|(1<<5)|(1<<4);
 		ILI932x_wr_cmd(0x03);						/* Set GRAM write direction and BGR=1 */ 
-		ILI932x_wr_dat((1<<12)|(1<<9)|(0<<7)|(1<<5)|(1<<4));
+		ILI932x_wr_dat(ili932x_entry);
 		ILI932x_wr_cmd(0x08);						/* Display Control 2(0x0202) */ 
 		ILI932x_wr_dat(0x0202);						/* Set the back porch and front porch */
 		ILI932x_wr_cmd(0x09);						/* Display Control 3(0x0000) */ 
@@ -1635,6 +1829,10 @@ void ILI932x_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+	ILI932x_set_rotation(ILI932x_ROTATION);
+
+	ili932x_asleep = 0;
+
 	ILI932x_clear();
 
 #if 0	/* test code RED */
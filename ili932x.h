@@ -2,8 +2,8 @@
 /*!
 	@file			ili932x.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        16.00
-    @date           2023.08.01
+    @version        20.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -YHY024006A				(ILI9325)	8/16bit mode.		@n
@@ -50,13 +50,17 @@
 		2014.10.15 V14.00	Fixed 8-bit access bug.
 		2023.05.01 V15.00	Removed unused delay function.
 		2023.08.01 V16.00	Revised release.
+		2026.10.19 V17.00	Single Start-Byte GRAM burst in SPI clear.
+		2026.10.19 V18.00	Added runtime rotation and column-major block write.
+		2026.10.19 V19.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V20.00	Added frame rate levels for adaptive refresh.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ILI932X_H
-#define ILI932X_H 0x1600
+#define ILI932X_H 0x2000
 
 #ifdef __cplusplus
  extern "C" {
@@ -95,6 +99,16 @@
 #define START_RD_STATUS		(ILI932x_ID | ID_IM0 | READ_STATUS)
 #define START_RD_DATA		(ILI932x_ID | ID_IM0 | READ_DATA)
 
+/* Entry Mode(R03h) Bits */
+#define ENTRY_ID1			(1<<5)
+#define ENTRY_ID0			(1<<4)
+#define ENTRY_AM			(1<<3)
+
+/* Default Rotation after Initialize (0/90/180/270) */
+#ifndef ILI932x_ROTATION
+ #define ILI932x_ROTATION	0
+#endif
+
 /* Display Contol Macros */
 #define ILI932x_RES_SET()	DISPLAY_RES_SET()
 #define ILI932x_RES_CLR()	DISPLAY_RES_CLR()
@@ -131,15 +145,26 @@
 #define ILI932x_CMD			DISPLAY_CMDPORT
 
 
+/* Frame Rate Levels */
+#define ILI932x_FRAME_RATES		5
+
 /* Display Control Functions Prototype */
 extern void ILI932x_reset(void);
 extern void ILI932x_init(void);
+extern void ILI932x_set_frame_rate(uint8_t level);
+extern const uint8_t ILI932x_frame_rate_hz[ILI932x_FRAME_RATES];
 extern void ILI932x_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void ILI932x_wr_cmd(uint8_t cmd);
 extern void ILI932x_wr_dat(uint16_t dat);
 extern void ILI932x_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ILI932x_clear(void);
 extern uint16_t ILI932x_rd_cmd(uint8_t cmd);
+extern void ILI932x_set_rotation(uint16_t deg);
+extern void ILI932x_sleep(void);
+extern void ILI932x_wake(void);
+extern void ILI932x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt);
+extern uint16_t ILI932x_max_x;
+extern uint16_t ILI932x_max_y;
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -152,6 +177,15 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ILI932x_wr_cmd
 #define Display_wr_block_if		ILI932x_wr_block
 #define Display_clear_if 		ILI932x_clear
+#define Display_set_frame_rate_if	ILI932x_set_frame_rate
+#define Display_frame_rate_hz_if	ILI932x_frame_rate_hz
+#define Display_frame_rates_if		ILI932x_FRAME_RATES
+#define Display_set_rotation_if		ILI932x_set_rotation
+#define Display_sleep_if		ILI932x_sleep
+#define Display_wake_if			ILI932x_wake
+#define Display_wr_block_colmajor_if	ILI932x_wr_block_colmajor
+#define Display_max_x_if		ILI932x_max_x
+#define Display_max_y_if		ILI932x_max_y
 
 #ifdef __cplusplus
 }
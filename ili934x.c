@@ -2,8 +2,8 @@
 /*!
 	@file			ili934x.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        14.00
-    @date           2023.09.01
+    @version        23.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				 	 	 @n
 					Available TFT-LCM are listed below.							 	 	 @n
 					 -SDT028ATFT				(ILI9341)	8/16bit & 4-Wire,8bitSerial. @n
@@ -30,6 +30,15 @@
 		2023.05.01 V12.00	Removed unused delay function.
 		2023.08.01 V13.00	Revised release.
 		2023.09.01 V14.00	Added DJN 15-12406-10481(NT39116B) support.
+		2026.10.19 V15.00	Added runtime rotation and column-major block write.
+		2026.10.19 V16.00	Added vertical scroll start address.
+		2026.10.19 V17.00	Added chunked block write with bus arbitration hook.
+		2026.10.19 V18.00	Added detected ID cache for warm reboot.
+		2026.10.19 V19.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V20.00	Added partial/idle low-power mode.
+		2026.10.19 V21.00	Added frame rate levels for adaptive refresh.
+		2026.10.19 V22.00	Validate cached ID by ID4 lower byte.
+		2026.10.19 V23.00	Added bus hold(CS low) over batched writes on spi mode.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -39,15 +48,41 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ili934x.h"
 /* check header file version for fool proof */
-#if ILI934X_H != 0x1400
+#if ILI934X_H != 0x2300
 #error "header file version is not correspond!"
 #endif
 
 /* Defines -------------------------------------------------------------------*/
 
 /* Variables -----------------------------------------------------------------*/
+/* Display Mode */
+uint8_t ILI934x_mode = ILI934x_MODE_NORMAL;
+/* Runtime Rotation State */
+static uint8_t  ili934x_madval;					/* MADCTL at rotation 0 */
+static uint8_t  ili934x_madctl;
+static uint16_t ili934x_ofs_col = OFS_COL;
+static uint16_t ili934x_ofs_raw = OFS_RAW;
+uint16_t ILI934x_max_x = MAX_X;
+uint16_t ILI934x_max_y = MAX_Y;
+/* Sleep/Wake State */
+static uint8_t  ili934x_asleep;
+static uint32_t ili934x_slpout_tick;				/* ticktime(1ms) at Sleep Out */
+#if defined(USE_ILI934x_SPI_TFT) && defined(ILI934x_BLOCK_CHUNK)
+/* Bus Arbitration Hook,called between chunks with CS released */
+static void (*ili934x_bus_yield)(void);
+#endif
+#ifdef USE_ILI934x_SPI_TFT
+/* CS is kept low between ILI934x_begin and ILI934x_end */
+static uint8_t  ili934x_hold;
+#define ILI934x_RELEASE_CS()	do { if (!ili934x_hold) DISPLAY_NEGATE_CS(); } while (0)
+#endif
 
 /* Constants -----------------------------------------------------------------*/
+/* Frame Rate Levels,DIVA and RTNA of FRMCTR1(B1h) */
+static const uint8_t ili934x_frc[ILI934x_FRAME_RATES][2] = {
+	{0x01,0x1F}, {0x01,0x15}, {0x00,0x1F}, {0x00,0x1B}
+};
+const uint8_t ILI934x_frame_rate_hz[ILI934x_FRAME_RATES] = { 30, 45, 61, 70 };
 
 /* Function prototypes -------------------------------------------------------*/
 
@@ -192,7 +227,7 @@ inline void ILI934x_wr_cmd(uint8_t cmd)
 
 	SendSPI(cmd);
 
-	DISPLAY_NEGATE_CS();						/* CS=H		     */
+	ILI934x_RELEASE_CS();						/* CS=H(unless held) */
 	ILI934x_DC_SET();							/* DC=H			 */
 }
 
@@ -207,7 +242,7 @@ inline void ILI934x_wr_dat(uint8_t dat)
 
 	SendSPI(dat);
 
-	DISPLAY_NEGATE_CS();						/* CS=H		     */
+	ILI934x_RELEASE_CS();						/* CS=H(unless held) */
 }
 
 /**************************************************************************/
@@ -221,15 +256,15 @@ inline void ILI934x_wr_gram(uint16_t gram)
 
 	SendSPI16(gram);
 
-	DISPLAY_NEGATE_CS();						/* CS=H		     */
+	ILI934x_RELEASE_CS();						/* CS=H(unless held) */
 }
 
 /**************************************************************************/
 /*! 
-    Write LCD Block Data.
+    Write LCD Block Data,One CS Period.
 */
 /**************************************************************************/
-inline void ILI934x_wr_block(uint8_t *p,unsigned int cnt)
+static inline void ILI934x_wr_chunk(uint8_t *p,unsigned int cnt)
 {
 
 	DISPLAY_ASSART_CS();						/* CS=L		     */
@@ -249,9 +284,71 @@ inline void ILI934x_wr_block(uint8_t *p,unsigned int cnt)
 	}
 #endif
 
+	ILI934x_RELEASE_CS();						/* CS=H(unless held) */
+}
+
+/**************************************************************************/
+/*! 
+    Write LCD Block Data.
+	With ILI934x_BLOCK_CHUNK,the bus is released between chunks and
+	the arbitration hook may run other SPI devices(touch,SD).
+	GRAM write resumes by Write Memory Continue on the same window.
+*/
+/**************************************************************************/
+inline void ILI934x_wr_block(uint8_t *p,unsigned int cnt)
+{
+#ifdef ILI934x_BLOCK_CHUNK
+	while (cnt > ILI934x_BLOCK_CHUNK) {
+		ILI934x_wr_chunk(p,ILI934x_BLOCK_CHUNK);
+		p   += ILI934x_BLOCK_CHUNK;
+		cnt -= ILI934x_BLOCK_CHUNK;
+
+		if (ili934x_bus_yield) {
+			DISPLAY_NEGATE_CS();				/* also when held */
+			ili934x_bus_yield();
+			ILI934x_wr_cmd(0x3C);				/* Write Memory Continue */
+		}
+	}
+#endif
+	ILI934x_wr_chunk(p,cnt);
+}
+
+/**************************************************************************/
+/*! 
+    Hold Bus,CS stays low over following writes until ILI934x_end.
+	Commands and data are told apart by DC only.
+*/
+/**************************************************************************/
+void ILI934x_begin(void)
+{
+	ili934x_hold = 1;
+	DISPLAY_ASSART_CS();						/* CS=L		     */
+}
+
+/**************************************************************************/
+/*! 
+    Release Bus held by ILI934x_begin.
+*/
+/**************************************************************************/
+void ILI934x_end(void)
+{
+	ili934x_hold = 0;
 	DISPLAY_NEGATE_CS();						/* CS=H		     */
 }
 
+#ifdef ILI934x_BLOCK_CHUNK
+/**************************************************************************/
+/*! 
+    Set Bus Arbitration Hook.
+	Hook MUST NOT access the panel,and MUST restore SPI mode/speed.
+*/
+/**************************************************************************/
+void ILI934x_set_bus_yield(void (*hook)(void))
+{
+	ili934x_bus_yield = hook;
+}
+#endif
+
 /**************************************************************************/
 /*! 
     Read LCD Register.
@@ -274,6 +371,22 @@ inline uint16_t ILI934x_rd_cmd(uint8_t cmd)
 	return val;
 }
 
+/**************************************************************************/
+/*! 
+    Read One Byte of Multi-Byte Register,n = 0..3.
+*/
+/**************************************************************************/
+static uint16_t ILI934x_rd_byte(uint8_t cmd, uint8_t n)
+{
+#ifndef USE_32F429IDISCOVERY
+	ILI934x_wr_cmd(0xD9);						/* SPI Register Read Command */
+	ILI934x_wr_dat(0x10 | n);    				/* Read Mode Enable,nth Byte */
+	return ILI934x_rd_cmd(cmd);
+#else
+	return (cmd == 0xD3) ? ((n == 3) ? 0x41 : (n == 2) ? 0x93 : 0) : 0;
+#endif
+}
+
 /**************************************************************************/
 /*! 
     Read ID ILI934x.
@@ -281,33 +394,18 @@ inline uint16_t ILI934x_rd_cmd(uint8_t cmd)
 /**************************************************************************/
 static uint16_t ILI934x_rd_id(uint8_t cmd)
 {
-#ifndef USE_32F429IDISCOVERY
 	uint16_t val;
 	uint16_t temp;
 
-	ILI934x_wr_cmd(0xD9);						/* SPI Register Read Command */
-	ILI934x_wr_dat(0x10);    					/* Read Mode Enable,1st Byte */
-	temp = ILI934x_rd_cmd(cmd);					/* Dummy Read 	*/
-	
-	ILI934x_wr_cmd(0xD9);						/* SPI Register Read Command */
-	ILI934x_wr_dat(0x11);    					/* Read Mode Enable,2nd Byte */
-	temp = ILI934x_rd_cmd(cmd);					/* Dummy Read 	*/
-	
-	ILI934x_wr_cmd(0xD9);						/* SPI Register Read Command */
-	ILI934x_wr_dat(0x12);    					/* Read Mode Enable,3rd Byte */
-	temp = ILI934x_rd_cmd(cmd);					/* Upper Read 	*/
-
-	ILI934x_wr_cmd(0xD9);						/* SPI Register Read Command */
-	ILI934x_wr_dat(0x13);    					/* Read Mode Enable,4th Byte */
-	val  = ILI934x_rd_cmd(cmd);					/* Lower Read	*/
+	temp = ILI934x_rd_byte(cmd, 0);				/* Dummy Read 	*/
+	temp = ILI934x_rd_byte(cmd, 1);				/* Dummy Read 	*/
+	temp = ILI934x_rd_byte(cmd, 2);				/* Upper Read 	*/
+	val  = ILI934x_rd_byte(cmd, 3);				/* Lower Read	*/
 
 	val &= 0x00FF;
 	val |= (uint16_t)temp<<8;
 
 	return val;
-#else
-	return 0x9341;
-#endif
 }
 #endif
 
@@ -321,16 +419,16 @@ inline void ILI934x_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height
 {
 
 	ILI934x_wr_cmd(0x2A);				/* Horizontal RAM Start ADDR */
-	ILI934x_wr_dat((OFS_COL + x)>>8);
-	ILI934x_wr_dat(OFS_COL + x);
-	ILI934x_wr_dat((OFS_COL + width)>>8);
-	ILI934x_wr_dat(OFS_COL + width);
+	ILI934x_wr_dat((ili934x_ofs_col + x)>>8);
+	ILI934x_wr_dat(ili934x_ofs_col + x);
+	ILI934x_wr_dat((ili934x_ofs_col + width)>>8);
+	ILI934x_wr_dat(ili934x_ofs_col + width);
 
 	ILI934x_wr_cmd(0x2B);				/* Horizontal RAM Start ADDR */
-	ILI934x_wr_dat((OFS_RAW + y)>>8);
-	ILI934x_wr_dat(OFS_RAW + y);
-	ILI934x_wr_dat((OFS_RAW + height)>>8);
-	ILI934x_wr_dat(OFS_RAW + height);
+	ILI934x_wr_dat((ili934x_ofs_raw + y)>>8);
+	ILI934x_wr_dat(ili934x_ofs_raw + y);
+	ILI934x_wr_dat((ili934x_ofs_raw + height)>>8);
+	ILI934x_wr_dat(ili934x_ofs_raw + height);
 
 	ILI934x_wr_cmd(0x2C);				/* Write Data to GRAM */
 
@@ -345,7 +443,7 @@ inline void ILI934x_clear(void)
 {
 	volatile uint32_t n;
 
-	ILI934x_rect(0,MAX_X-1,0,MAX_Y-1);
+	ILI934x_rect(0,ILI934x_max_x-1,0,ILI934x_max_y-1);
 	n = (uint32_t)(MAX_X) * (MAX_Y);
 
 	do {
@@ -355,6 +453,162 @@ inline void ILI934x_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Vertical Scroll Start Address.
+*/
+/**************************************************************************/
+void ILI934x_scroll(uint32_t line)
+{
+	ILI934x_wr_cmd(0x37);				/* Vertical Scrolling Start Address */
+	ILI934x_wr_dat(line>>8);
+	ILI934x_wr_dat(line);
+}
+
+/**************************************************************************/
+/*! 
+    Set Display Rotation(0/90/180/270 degree).
+*/
+/**************************************************************************/
+void ILI934x_set_rotation(uint16_t deg)
+{
+	static const uint8_t madrot[4] = { 0, MADCTL_MV|MADCTL_MX, MADCTL_MX|MADCTL_MY, MADCTL_MV|MADCTL_MY };
+	uint8_t r = (uint8_t)((deg / 90) & 3);
+
+	ili934x_madctl = ili934x_madval ^ madrot[r];
+	ILI934x_wr_cmd(0x36);				/* Memory Access Control */
+	ILI934x_wr_dat(ili934x_madctl);
+
+	if (r & 1) {
+		ILI934x_max_x   = MAX_Y;
+		ILI934x_max_y   = MAX_X;
+		ili934x_ofs_col = OFS_RAW;
+		ili934x_ofs_raw = OFS_COL;
+	}
+	else {
+		ILI934x_max_x   = MAX_X;
+		ILI934x_max_y   = MAX_Y;
+		ili934x_ofs_col = OFS_COL;
+		ili934x_ofs_raw = OFS_RAW;
+	}
+}
+
+/**************************************************************************/
+/*! 
+    Write Column-Major Block Data.
+	Exchange Row/Column(MV) only while this blit,no transpose needed.
+*/
+/**************************************************************************/
+void ILI934x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt)
+{
+	uint16_t ofs;
+
+	ILI934x_wr_cmd(0x36);				/* Memory Access Control */
+	ILI934x_wr_dat(ili934x_madctl ^ MADCTL_MV);
+
+	ofs = ili934x_ofs_col; ili934x_ofs_col = ili934x_ofs_raw; ili934x_ofs_raw = ofs;
+	ILI934x_rect(y,height,x,width);
+	ofs = ili934x_ofs_col; ili934x_ofs_col = ili934x_ofs_raw; ili934x_ofs_raw = ofs;
+
+	ILI934x_wr_block(p,cnt);
+
+	ILI934x_wr_cmd(0x36);				/* Memory Access Control */
+	ILI934x_wr_dat(ili934x_madctl);
+}
+
+/**************************************************************************/
+/*! 
+    Enter Sleep Mode,GRAM and registers are kept.
+	Sleep In MUST be 120ms or more after Sleep Out.
+*/
+/**************************************************************************/
+void ILI934x_sleep(void)
+{
+	uint32_t t;
+
+	if (ili934x_asleep) return;
+
+	t = ticktime - ili934x_slpout_tick;
+	if (t < 120) _delay_ms(120 - t);	/* only the rest of 120ms */
+
+	ILI934x_wr_cmd(0x28);				/* Display OFF */
+	ILI934x_wr_cmd(0x10);				/* Sleep IN */
+	_delay_ms(5);						/* wait 5ms before next command */
+
+	ili934x_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Sleep Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ILI934x_wake(void)
+{
+	if (!ili934x_asleep) return;
+
+	ILI934x_wr_cmd(0x11);				/* Sleep OUT */
+	_delay_ms(5);						/* wait 5ms before next command */
+	ILI934x_wr_cmd(0x29);				/* Display ON */
+
+	ili934x_slpout_tick = ticktime;
+	ili934x_asleep = 0;
+}
+
+
+/**************************************************************************/
+/*! 
+    Enter Partial and Idle(8 colours) Mode.
+	top/bottom are panel rows at rotation 0,rows outside are not driven.
+	Called again in this mode,only the area is moved.
+*/
+/**************************************************************************/
+void ILI934x_partial_idle(uint16_t top, uint16_t bottom)
+{
+	ILI934x_wr_cmd(0x30);				/* Partial Area */
+	ILI934x_wr_dat((OFS_RAW + top)>>8);
+	ILI934x_wr_dat(OFS_RAW + top);
+	ILI934x_wr_dat((OFS_RAW + bottom)>>8);
+	ILI934x_wr_dat(OFS_RAW + bottom);
+
+	if (ILI934x_mode == ILI934x_MODE_PARTIAL_IDLE) return;
+
+	ILI934x_wr_cmd(0x12);				/* Partial Mode ON */
+	ILI934x_wr_cmd(0x39);				/* Idle Mode ON */
+
+	ILI934x_mode = ILI934x_MODE_PARTIAL_IDLE;
+}
+
+/**************************************************************************/
+/*! 
+    Back to Normal Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ILI934x_normal(void)
+{
+	if (ILI934x_mode == ILI934x_MODE_NORMAL) return;
+
+	ILI934x_wr_cmd(0x13);				/* Normal Display Mode ON */
+	ILI934x_wr_cmd(0x38);				/* Idle Mode OFF */
+
+	ILI934x_mode = ILI934x_MODE_NORMAL;
+}
+
+/**************************************************************************/
+/*! 
+    Set Frame Rate Level in Normal Mode,0 = slowest.
+*/
+/**************************************************************************/
+void ILI934x_set_frame_rate(uint8_t level)
+{
+	if (level >= ILI934x_FRAME_RATES) level = ILI934x_FRAME_RATES - 1;
+
+	ILI934x_wr_cmd(0xB1);				/* Frame Rate Control(Normal Mode) */
+	ILI934x_wr_dat(ili934x_frc[level][0]);	/* DIVA */
+	ILI934x_wr_dat(ili934x_frc[level][1]);	/* RTNA */
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -363,6 +617,9 @@ inline void ILI934x_clear(void)
 void ILI934x_init(void)
 {
 	uint16_t devicetype;
+#if defined(USE_ILI934x_SPI_TFT) && defined(DISPLAY_ID_CACHE)
+	uint16_t idcheck;
+#endif
 
 	Display_IoInit_If();
 
@@ -372,6 +629,10 @@ void ILI934x_init(void)
 #ifdef USE_ILI934x_TFT
 	devicetype = ILI934x_rd_cmd(0xD3);  	/* Confirm Vaild LCD Controller */
 #elif USE_ILI934x_SPI_TFT
+ #ifdef DISPLAY_ID_CACHE
+	idcheck = ILI934x_rd_byte(0xD3, 3);		/* ID4 lower byte(41h/40h),one prefixed read */
+	if (DispIdCache_load(ILI934x_IDCACHE_TAG, idcheck, &devicetype, 1))
+ #endif
 	devicetype = ILI934x_rd_id(0xD3);  		/* Confirm Vaild LCD Controller Serial Interface */
 #endif
 
@@ -435,12 +696,13 @@ void ILI934x_init(void)
 		ILI934x_wr_cmd(0xC7);			/* vcom adjust control */
 		ILI934x_wr_dat(0x90);
 
-		ILI934x_wr_cmd(0x36);			/* Memory Access Control */
 #if defined(USE_32F429IDISCOVERY)
-		ILI934x_wr_dat((1<<7)|(1<<3));  /*  Vertically Inverted */
+		ili934x_madval = (1<<7)|(1<<3);	/*  Vertically Inverted */
 #else
-		ILI934x_wr_dat(0x48);   
+		ili934x_madval = 0x48;
 #endif
+		ILI934x_wr_cmd(0x36);			/* Memory Access Control */
+		ILI934x_wr_dat(ili934x_madval);
 		ILI934x_wr_cmd(0xF2);			/* 3Gamma Function Disable */ 
         ILI934x_wr_dat(0x00);
 		
@@ -574,8 +836,9 @@ void ILI934x_init(void)
 		ILI934x_wr_cmd(0x3A);
 		ILI934x_wr_dat(0x55);
 		
+		ili934x_madval = 0x48;
 		ILI934x_wr_cmd(0x36);					/* Memory Access Control */
-		ILI934x_wr_dat(0x48);
+		ILI934x_wr_dat(ili934x_madval);
 		
 		ILI934x_wr_cmd(0xB1);           
 		ILI934x_wr_dat(0x00);
@@ -697,8 +960,9 @@ void ILI934x_init(void)
 		ILI934x_wr_cmd(0x11);					/* Exit Sleep */
 		_delay_ms(10);
 		
+		ili934x_madval = (0<<7)|(1<<6)|(0<<5)|(0<<4)|(1<<3)|(0<<2);		/* Set pixel write order: Red, Green, Blue */
 		ILI934x_wr_cmd(0x36);
-		ILI934x_wr_dat((0<<7)|(1<<6)|(0<<5)|(0<<4)|(1<<3)|(0<<2));		/* Set pixel write order: Red, Green, Blue */
+		ILI934x_wr_dat(ili934x_madval);
 		
 		ILI934x_wr_cmd(0x3A);
 		ILI934x_wr_dat(0x05);
@@ -739,8 +1003,9 @@ void ILI934x_init(void)
 		ILI934x_wr_cmd(0xC7);
 		ILI934x_wr_dat(0xC4);
 		
+		ili934x_madval = (1<<7)|(1<<6)|(0<<5)|(1<<4)|(1<<3)|(0<<2);		/* Set pixel write order: Red, Green, Blue */
 		ILI934x_wr_cmd(0x36);
-		ILI934x_wr_dat((1<<7)|(1<<6)|(0<<5)|(1<<4)|(1<<3)|(0<<2));		/* Set pixel write order: Red, Green, Blue */
+		ILI934x_wr_dat(ili934x_madval);
 		
 		ILI934x_wr_cmd(0x26);
 		ILI934x_wr_dat(0x10);
@@ -788,6 +1053,17 @@ void ILI934x_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+#if defined(USE_ILI934x_SPI_TFT) && defined(DISPLAY_ID_CACHE)
+	DispIdCache_save(ILI934x_IDCACHE_TAG, idcheck, &devicetype, 1);
+#endif
+
+	ILI934x_set_rotation(ILI934x_ROTATION);
+
+	ili934x_asleep = 0;
+	ili934x_slpout_tick = ticktime;
+
+	ILI934x_mode = ILI934x_MODE_NORMAL;
+
 	ILI934x_clear();
 
 #if 0	/* test code RED */
@@ -2,8 +2,8 @@
 /*!
 	@file			ili934x.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        14.00
-    @date           2023.09.01
+    @version        23.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				 	 	 @n
 					Available TFT-LCM are listed below.							 	 	 @n
 					 -SDT028ATFT				(ILI9341)	8/16bit & 4-Wire,8bitSerial. @n
@@ -30,13 +30,22 @@
 		2023.05.01 V12.00	Removed unused delay function.
 		2023.08.01 V13.00	Revised release.
 		2023.09.01 V14.00	Added DJN 15-12406-10481(NT39116B) support.
+		2026.10.19 V15.00	Added runtime rotation and column-major block write.
+		2026.10.19 V16.00	Added vertical scroll start address.
+		2026.10.19 V17.00	Added chunked block write with bus arbitration hook.
+		2026.10.19 V18.00	Added detected ID cache for warm reboot.
+		2026.10.19 V19.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V20.00	Added partial/idle low-power mode.
+		2026.10.19 V21.00	Added frame rate levels for adaptive refresh.
+		2026.10.19 V22.00	Validate cached ID by ID4 lower byte.
+		2026.10.19 V23.00	Added bus hold(CS low) over batched writes on spi mode.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ILI934X_H
-#define ILI934X_H 0x1400
+#define ILI934X_H 0x2300
 
 #ifdef __cplusplus
  extern "C" {
@@ -48,6 +57,10 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#ifdef DISPLAY_ID_CACHE
+ #include "display_idcache.h"
+ #define ILI934x_IDCACHE_TAG	0x93410002			/* serial interface probe,checked by ID4 */
+#endif
 
 /* ILI934x unique value */
 /* mst be need for ILI934x */
@@ -86,9 +99,41 @@
 #define ILI934x_CMD			DISPLAY_CMDPORT
 
 
+/* MADCTL Bits */
+#define MADCTL_MY			(1<<7)
+#define MADCTL_MX			(1<<6)
+#define MADCTL_MV			(1<<5)
+#define MADCTL_ML			(1<<4)
+#define MADCTL_BGR			(1<<3)
+#define MADCTL_MH			(1<<2)
+
+/* Default Rotation after Initialize (0/90/180/270) */
+#ifndef ILI934x_ROTATION
+ #define ILI934x_ROTATION	0
+#endif
+
+/* Block Write Chunk(bytes) on Shared SPI Bus,MUST be multiple of 4.
+   Define to bound other devices' bus latency,undefined = one transfer */
+/* #define ILI934x_BLOCK_CHUNK	4096 */
+#if defined(ILI934x_BLOCK_CHUNK) && (ILI934x_BLOCK_CHUNK & 3)
+ #error "ILI934x_BLOCK_CHUNK MUST be multiple of 4!"
+#endif
+
+/* Display Mode */
+#define ILI934x_MODE_NORMAL			0
+#define ILI934x_MODE_PARTIAL_IDLE	1
+
+/* Frame Rate Levels */
+#define ILI934x_FRAME_RATES		4
+
 /* Display Control Functions Prototype */
 extern void ILI934x_reset(void);
 extern void ILI934x_init(void);
+extern void ILI934x_set_frame_rate(uint8_t level);
+extern const uint8_t ILI934x_frame_rate_hz[ILI934x_FRAME_RATES];
+extern void ILI934x_partial_idle(uint16_t top, uint16_t bottom);
+extern void ILI934x_normal(void);
+extern uint8_t ILI934x_mode;
 extern void ILI934x_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void ILI934x_wr_cmd(uint8_t cmd);
 extern void ILI934x_wr_dat(uint8_t dat);
@@ -96,6 +141,20 @@ extern void ILI934x_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ILI934x_clear(void);
 extern uint16_t ILI934x_rd_cmd(uint8_t cmd);
 extern void ILI934x_wr_gram(uint16_t gram);
+extern void ILI934x_set_rotation(uint16_t deg);
+extern void ILI934x_scroll(uint32_t line);
+extern void ILI934x_sleep(void);
+extern void ILI934x_wake(void);
+#ifdef USE_ILI934x_SPI_TFT
+extern void ILI934x_begin(void);
+extern void ILI934x_end(void);
+#endif
+#if defined(USE_ILI934x_SPI_TFT) && defined(ILI934x_BLOCK_CHUNK)
+extern void ILI934x_set_bus_yield(void (*hook)(void));
+#endif
+extern void ILI934x_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt);
+extern uint16_t ILI934x_max_x;
+extern uint16_t ILI934x_max_y;
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -108,6 +167,26 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ILI934x_wr_cmd
 #define Display_wr_block_if		ILI934x_wr_block
 #define Display_clear_if 		ILI934x_clear
+#define Display_set_frame_rate_if	ILI934x_set_frame_rate
+#define Display_frame_rate_hz_if	ILI934x_frame_rate_hz
+#define Display_frame_rates_if		ILI934x_FRAME_RATES
+#define Display_partial_idle_if	ILI934x_partial_idle
+#define Display_normal_if		ILI934x_normal
+#define Display_mode_if			ILI934x_mode
+#define Display_set_rotation_if		ILI934x_set_rotation
+#define Display_scroll_if		ILI934x_scroll
+#define Display_sleep_if		ILI934x_sleep
+#define Display_wake_if			ILI934x_wake
+#define Display_wr_block_colmajor_if	ILI934x_wr_block_colmajor
+#define Display_max_x_if		ILI934x_max_x
+#define Display_max_y_if		ILI934x_max_y
+#ifdef USE_ILI934x_SPI_TFT
+ #define Display_begin_if		ILI934x_begin
+ #define Display_end_if			ILI934x_end
+#endif
+#if defined(USE_ILI934x_SPI_TFT) && defined(ILI934x_BLOCK_CHUNK)
+ #define Display_set_bus_yield_if	ILI934x_set_bus_yield
+#endif
 
 #ifdef __cplusplus
 }
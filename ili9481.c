@@ -2,8 +2,8 @@
 /*!
 	@file			ili9481.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        16.00
-    @date           2023.08.01
+    @version        19.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -S95517-AAA				(ILI9481)	16bit mode.			@n
@@ -38,6 +38,9 @@
 		2016.11.04 V14.00	Fixed DeviceID Read Command on spi mode.
 		2023.05.01 V15.00	Removed unused delay function.
 		2023.08.01 V16.00	Revised release.
+		2026.10.19 V17.00	Added detected ID cache for warm reboot.
+		2026.10.19 V18.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V19.00	Validate cached ID by each controller ID read.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -47,13 +50,16 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ili9481.h"
 /* check header file version for fool proof */
-#if ILI9481_H != 0x1600
+#if ILI9481_H != 0x1900
 #error "header file version is not correspond!"
 #endif
 
 /* Defines -------------------------------------------------------------------*/
 
 /* Variables -----------------------------------------------------------------*/
+/* Sleep/Wake State */
+static uint8_t  ili9481_asleep;
+static uint32_t ili9481_slpout_tick;				/* ticktime(1ms) at Sleep Out */
 
 /* Constants -----------------------------------------------------------------*/
 
@@ -512,6 +518,45 @@ inline void ILI9481_clear(void)
 
 }
 
+/**************************************************************************/
+/*! 
+    Enter Sleep Mode,GRAM and registers are kept.
+	Sleep In MUST be 120ms or more after Sleep Out.
+*/
+/**************************************************************************/
+void ILI9481_sleep(void)
+{
+	uint32_t t;
+
+	if (ili9481_asleep) return;
+
+	t = ticktime - ili9481_slpout_tick;
+	if (t < 120) _delay_ms(120 - t);	/* only the rest of 120ms */
+
+	ILI9481_wr_cmd(0x28);				/* Display OFF */
+	ILI9481_wr_cmd(0x10);				/* Sleep IN */
+	_delay_ms(5);						/* wait 5ms before next command */
+
+	ili9481_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Sleep Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ILI9481_wake(void)
+{
+	if (!ili9481_asleep) return;
+
+	ILI9481_wr_cmd(0x11);				/* Sleep OUT */
+	_delay_ms(ILI9481_SLPOUT_WAIT);		/* wait before next command */
+	ILI9481_wr_cmd(0x29);				/* Display ON */
+
+	ili9481_slpout_tick = ticktime;
+	ili9481_asleep = 0;
+}
+
 
 /**************************************************************************/
 /*! 
@@ -524,6 +569,11 @@ void ILI9481_init(void)
 #if   defined(USE_ILI9481_SPI_TFT)
 	volatile uint16_t id61581;
 #endif
+#ifdef DISPLAY_ID_CACHE
+	uint16_t idcache[3] = {0,0,0};
+	uint16_t idcheck;
+	uint8_t  idprobe;
+#endif
 
 	Display_IoInit_If();
 
@@ -535,6 +585,37 @@ void ILI9481_init(void)
 
 	/* Check Device Code */
 	devicetype = ILI9481_rd_cmd(0xBF);  	/* Confirm Vaild LCD Controller */
+#ifdef DISPLAY_ID_CACHE
+	/* BFh is 0 on ILI9486/88,HX8357C/D(and serial R61581),so probes are read
+	   in order until the first non-zero ID,that ID is the cache check and
+	   its probe index goes into the tag.Rest of probes are skipped on hit */
+	id9486l    = 0;
+	ihx8357c   = 0;
+	idprobe    = 0;
+	idcheck    = devicetype;
+ #if defined(USE_ILI9481_SPI_TFT)
+	id61581    = 0;
+	if (!idcheck) { idprobe = 1; idcheck = id61581  = R61581_rd_id(0xBF); }
+ #endif
+	if (!idcheck) { idprobe = 2; idcheck = id9486l  = ILI9486_rd_id(0xD3); }
+	if (!idcheck) { idprobe = 3; idcheck = ihx8357c = HX8357C_rd_id(0xD0); }
+	if (!DispIdCache_load(ILI9481_IDCACHE_TAG | (uint32_t)idprobe << 8, idcheck, idcache, 3))
+	{
+		id9486l    = idcache[0];
+		ihx8357c   = idcache[1];
+ #if defined(USE_ILI9481_SPI_TFT)
+		id61581    = idcache[2];
+ #endif
+	}
+	else
+	{
+ #if defined(USE_ILI9481_SPI_TFT)
+		if (idprobe < 1) id61581  = R61581_rd_id(0xBF);
+ #endif
+		if (idprobe < 2) id9486l  = ILI9486_rd_id(0xD3);
+		if (idprobe < 3) ihx8357c = HX8357C_rd_id(0xD0);
+	}
+#else
 #if   defined(USE_ILI9481_TFT)
 	id9486l    = ILI9486_rd_id(0xD3);  		/* Confirm Vaild LCD Controller for ILI9486L */
 	ihx8357c   = HX8357C_rd_id(0xD0);  		/* Confirm Vaild LCD Controller for HX8357C/D */
@@ -542,6 +623,7 @@ void ILI9481_init(void)
 	id61581    = R61581_rd_id(0xBF);  		/* Confirm Vaild LCD Controller for R61581/B Serial Interface */
 	id9486l    = ILI9486_rd_id(0xD3);  		/* Confirm Vaild LCD Controller for ILI9486L Serial Interface */
 	ihx8357c   = HX8357C_rd_id(0xD0);  		/* Confirm Vaild LCD Controller for HX8357C/D Serial Interface */
+#endif
 #endif
 
 	if(devicetype == 0x9481)
@@ -1312,6 +1394,18 @@ void ILI9481_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+#ifdef DISPLAY_ID_CACHE
+	idcache[0] = id9486l;
+	idcache[1] = ihx8357c;
+ #if defined(USE_ILI9481_SPI_TFT)
+	idcache[2] = id61581;
+ #endif
+	DispIdCache_save(ILI9481_IDCACHE_TAG | (uint32_t)idprobe << 8, idcheck, idcache, 3);
+#endif
+
+	ili9481_asleep = 0;
+	ili9481_slpout_tick = ticktime;
+
 	ILI9481_clear();
 
 #if 0 	/* test code RED */
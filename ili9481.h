@@ -2,8 +2,8 @@
 /*!
 	@file			ili9481.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        16.00
-    @date           2023.08.01
+    @version        19.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -S95517-AAA				(ILI9481)	16bit mode.			@n
@@ -38,13 +38,16 @@
 		2016.11.04 V14.00	Fixed DeviceID Read Command on spi mode.
 		2023.05.01 V15.00	Removed unused delay function.
 		2023.08.01 V16.00	Revised release.
+		2026.10.19 V17.00	Added detected ID cache for warm reboot.
+		2026.10.19 V18.00	Added sleep/wake keeping GRAM.
+		2026.10.19 V19.00	Validate cached ID by each controller ID read.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ILI9481_H
-#define ILI9481_H 0x1600
+#define ILI9481_H 0x1900
 
 #ifdef __cplusplus
  extern "C" {
@@ -56,6 +59,14 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#ifdef DISPLAY_ID_CACHE
+ #include "display_idcache.h"
+ #if defined(USE_ILI9481_SPI_TFT)
+  #define ILI9481_IDCACHE_TAG	0x94810003			/* serial interface probe,probe index at bit8 */
+ #else
+  #define ILI9481_IDCACHE_TAG	0x94810002			/* i8080 interface probe,probe index at bit8 */
+ #endif
+#endif
 
 /* ILI9481 unique value */
 /* mst be need for ILI9481 */
@@ -64,6 +75,11 @@
 #define MAX_X				320
 #define MAX_Y				480
 
+/* Wait after Sleep Out(ms),5ms for ILI9481/ILI9486/HX8357 */
+#ifndef ILI9481_SLPOUT_WAIT
+ #define ILI9481_SLPOUT_WAIT	5
+#endif
+
 /* For TFT1P2797-E (with TouchPanel model ILI9481) module Force */
 /*#define USE_TFT1P2797_E*/
 /* For TFT1P7134-E (with TouchPanel model R61581) module Force */
@@ -147,6 +163,8 @@ extern void ILI9481_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ILI9481_clear(void);
 extern uint16_t ILI9481_rd_cmd(uint8_t cmd);
 extern void ILI9481_wr_gram(uint16_t gram);
+extern void ILI9481_sleep(void);
+extern void ILI9481_wake(void);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -159,6 +177,8 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ILI9481_wr_cmd
 #define Display_wr_block_if		ILI9481_wr_block
 #define Display_clear_if 		ILI9481_clear
+#define Display_sleep_if		ILI9481_sleep
+#define Display_wake_if			ILI9481_wake
 
 #ifdef __cplusplus
 }
@@ -2,8 +2,8 @@
 /*!
 	@file			nt35510.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive TK040F1510 TFT module(8/16bit mode).
 
@@ -12,6 +12,7 @@
 		2014.10.15	V2.00	Fixed 8-bit access bug.
 		2023.05.01	V3.00	Removed unused delay function.
 		2023.08.01  V4.00	Revised initialize routine.
+		2026.10.19	V5.00	Added partial/idle low-power mode.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -21,13 +22,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include "nt35510.h"
 /* check header file version for fool proof */
-#if NT35510_H != 0x0400
+#if NT35510_H != 0x0500
 #error "header file version is not correspond!"
 #endif
 
 /* Defines -------------------------------------------------------------------*/
 
 /* Variables -----------------------------------------------------------------*/
+/* Display Mode */
+uint8_t NT35510_mode = NT35510_MODE_NORMAL;
 
 /* Constants -----------------------------------------------------------------*/
 
@@ -206,6 +209,48 @@ inline uint16_t NT35510_rd_cmd(uint16_t cmd)
 }
 
 
+/**************************************************************************/
+/*! 
+    Enter Partial and Idle(8 colours) Mode.
+	top/bottom are panel rows at rotation 0,rows outside are not driven.
+	Called again in this mode,only the area is moved.
+*/
+/**************************************************************************/
+void NT35510_partial_idle(uint16_t top, uint16_t bottom)
+{
+	NT35510_wr_cmd(0x3000);				/* Partial Area */
+	NT35510_wr_dat((OFS_RAW + top)>>8);
+	NT35510_wr_cmd(0x3001);
+	NT35510_wr_dat(OFS_RAW + top);
+	NT35510_wr_cmd(0x3002);
+	NT35510_wr_dat((OFS_RAW + bottom)>>8);
+	NT35510_wr_cmd(0x3003);
+	NT35510_wr_dat(OFS_RAW + bottom);
+
+	if (NT35510_mode == NT35510_MODE_PARTIAL_IDLE) return;
+
+	NT35510_wr_cmd(0x1200);				/* Partial Mode ON */
+	NT35510_wr_cmd(0x3900);				/* Idle Mode ON */
+
+	NT35510_mode = NT35510_MODE_PARTIAL_IDLE;
+}
+
+/**************************************************************************/
+/*! 
+    Back to Normal Mode without Re-initialize.
+*/
+/**************************************************************************/
+void NT35510_normal(void)
+{
+	if (NT35510_mode == NT35510_MODE_NORMAL) return;
+
+	NT35510_wr_cmd(0x1300);				/* Normal Display Mode ON */
+	NT35510_wr_cmd(0x3800);				/* Idle Mode OFF */
+
+	NT35510_mode = NT35510_MODE_NORMAL;
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -1043,6 +1088,8 @@ void NT35510_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+	NT35510_mode = NT35510_MODE_NORMAL;
+
 	NT35510_clear();
 
 #if 0	/* test code RED */
@@ -2,8 +2,8 @@
 /*!
 	@file			nt35510.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive TK040F1510 TFT module(8/16bit mode).
 
@@ -12,13 +12,14 @@
 		2014.10.15	V2.00	Fixed 8-bit access bug.
 		2023.05.01	V3.00	Removed unused delay function.
 		2023.08.01  V4.00	Revised initialize routine.
+		2026.10.19	V5.00	Added partial/idle low-power mode.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef NT35510_H
-#define NT35510_H 0x0400
+#define NT35510_H 0x0500
 
 #ifdef __cplusplus
  extern "C" {
@@ -62,9 +63,16 @@
 #define NT35510_CMD			DISPLAY_CMDPORT
 
 
+/* Display Mode */
+#define NT35510_MODE_NORMAL			0
+#define NT35510_MODE_PARTIAL_IDLE	1
+
 /* Display Control Functions Prototype */
 extern void NT35510_reset(void);
 extern void NT35510_init(void);
+extern void NT35510_partial_idle(uint16_t top, uint16_t bottom);
+extern void NT35510_normal(void);
+extern uint8_t NT35510_mode;
 extern void NT35510_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void NT35510_wr_cmd(uint16_t cmd);
 extern void NT35510_wr_dat(uint16_t dat);
@@ -83,6 +91,9 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		NT35510_wr_cmd
 #define Display_wr_block_if		NT35510_wr_block
 #define Display_clear_if 		NT35510_clear
+#define Display_partial_idle_if	NT35510_partial_idle
+#define Display_normal_if		NT35510_normal
+#define Display_mode_if			NT35510_mode
 
 #ifdef __cplusplus
 }
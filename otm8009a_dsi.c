@@ -2,8 +2,8 @@
 /*!
 	@file			otm8009a_dsi.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2024.08.01
+    @version        6.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -STM32F769I-Discovery		(OTM8009A)	DSI-Interface		@n
@@ -14,6 +14,8 @@
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
 		2024.08.01	V4.00	Fixed unused parameter.
+		2026.10.19	V5.00	Added software framebuffer backend.
+		2026.10.19	V6.00	Fixed double buffer clear on init.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -23,7 +25,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "otm8009a_dsi.h"
 /* check header file version for fool proof */
-#if OTM8009A_DSI_H != 0x0400
+#if OTM8009A_DSI_H != 0x0600
 #error "header file version is not correspond!"
 #endif
 
@@ -73,7 +75,11 @@ inline void OTM8009A_wr_dat(uint8_t dat)
 /**************************************************************************/
 inline void OTM8009A_wr_gram(uint16_t gram)
 {	
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_wr_gram(gram);
+#else
 	(void)gram;
+#endif
 }
 
 /**************************************************************************/
@@ -83,8 +89,12 @@ inline void OTM8009A_wr_gram(uint16_t gram)
 /**************************************************************************/
 inline void OTM8009A_wr_block(uint8_t *p,unsigned int cnt)
 {
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_wr_block(p,cnt);
+#else
 	(void)p;
 	(void)cnt;
+#endif
 }
 
 /**************************************************************************/
@@ -94,10 +104,14 @@ inline void OTM8009A_wr_block(uint8_t *p,unsigned int cnt)
 /**************************************************************************/
 inline void OTM8009A_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
 {
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_rect(x,width,y,height);
+#else
 	(void)x;
 	(void)width;
 	(void)y;
 	(void)height;
+#endif
 }
 
 /**************************************************************************/
@@ -107,7 +121,9 @@ inline void OTM8009A_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t heigh
 /**************************************************************************/
 inline void OTM8009A_clear(void)
 {
-
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_clear();
+#endif
 }
 
 
@@ -121,6 +137,15 @@ void OTM8009A_init(void)
 	/* Set LCD-Controller to DSI Interface */
 	Display_DSIIF_Init();
 
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	/* Attach Software Framebuffer,LTDC scans OTM8009A_FB0 at first */
+	DispFB_init(OTM8009A_FB0,OTM8009A_FB1,MAX_X,MAX_Y);
+	if (OTM8009A_FB1 != NULL) {
+		/* Clear scanned buffer directly,drawing buffer is cleared below */
+		memset(DispFB_front(),0,MAX_X*MAX_Y*sizeof(uint16_t));
+	}
+#endif
+
 	/* Flush Display */
 	Display_clear_if();
 
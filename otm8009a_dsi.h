@@ -2,8 +2,8 @@
 /*!
 	@file			otm8009a_dsi.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2024.08.01
+    @version        6.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -STM32F769I-Discovery		(OTM8009A)	DSI-Interface		@n
@@ -14,13 +14,15 @@
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
 		2024.08.01	V4.00	Fixed unused parameter.
+		2026.10.19	V5.00	Added software framebuffer backend.
+		2026.10.19	V6.00	Fixed double buffer clear on init.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef OTM8009A_DSI_H
-#define OTM8009A_DSI_H 0x0400
+#define OTM8009A_DSI_H 0x0600
 
 #ifdef __cplusplus
  extern "C" {
@@ -45,6 +47,17 @@
 #define MAX_X				800
 #define MAX_Y				480
 
+/* Software Framebuffer Location (override in MAKEFILE if needed) */
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+ #include "display_fb.h"
+ #ifndef OTM8009A_FB0
+  #define OTM8009A_FB0		((uint16_t*)0xC0000000)
+ #endif
+ #ifndef OTM8009A_FB1
+  #define OTM8009A_FB1		(OTM8009A_FB0 + (MAX_X*MAX_Y))
+ #endif
+#endif
+
 /* Display Contol Macros */
 
 
@@ -64,12 +77,21 @@ extern void OTM8009A_wr_gram(uint16_t gram);
 extern volatile uint32_t ticktime;
 
 /* Macros From Application Layer */
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+#define Display_init_if			OTM8009A_init
+#define Display_rect_if 		OTM8009A_rect
+#define Display_wr_dat_if		OTM8009A_wr_gram
+#define Display_wr_cmd_if		OTM8009A_wr_cmd
+#define Display_wr_block_if		OTM8009A_wr_block
+#define Display_clear_if 		OTM8009A_clear
+#else
 #define Display_init_if			OTM8009A_init
 extern void Display_rect_if(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void Display_wr_dat_if(uint16_t gram);
 #define Display_wr_cmd_if		OTM8009A_wr_cmd
 extern void Display_wr_block_if(uint8_t* blockdata,unsigned int datacount);
 extern void Display_clear_if(void);
+#endif
 
 #ifdef __cplusplus
 }
@@ -2,8 +2,8 @@
 /*!
 	@file			rk043fn48h_rgb.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				 	 	 @n
 					Available TFT-LCM are listed below.							 	 	 @n
 					 -STM32F746G-Discovery		(RK043FN48H)	RGB-Interface
@@ -12,6 +12,8 @@
 		2015.08.01	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added software framebuffer backend.
+		2026.10.19	V5.00	Fixed double buffer clear on init.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -21,7 +23,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "rk043fn48h_rgb.h"
 /* check header file version for fool proof */
-#if RK043FN48H_RGB_H != 0x0200
+#if RK043FN48H_RGB_H != 0x0500
 #error "header file version is not correspond!"
 #endif
 
@@ -52,7 +54,7 @@ inline void RK043FN48H_reset(void)
 /**************************************************************************/
 inline void RK043FN48H_wr_cmd(uint8_t cmd)
 {
-
+	(void)cmd;
 }
 
 /**************************************************************************/
@@ -62,7 +64,7 @@ inline void RK043FN48H_wr_cmd(uint8_t cmd)
 /**************************************************************************/
 inline void RK043FN48H_wr_dat(uint8_t dat)
 {	
-
+	(void)dat;
 }
 
 /**************************************************************************/
@@ -72,7 +74,11 @@ inline void RK043FN48H_wr_dat(uint8_t dat)
 /**************************************************************************/
 inline void RK043FN48H_wr_gram(uint16_t gram)
 {	
-
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_wr_gram(gram);
+#else
+	(void)gram;
+#endif
 }
 
 /**************************************************************************/
@@ -82,7 +88,12 @@ inline void RK043FN48H_wr_gram(uint16_t gram)
 /**************************************************************************/
 inline void RK043FN48H_wr_block(uint8_t *p,unsigned int cnt)
 {
-
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_wr_block(p,cnt);
+#else
+	(void)p;
+	(void)cnt;
+#endif
 }
 
 /**************************************************************************/
@@ -92,7 +103,14 @@ inline void RK043FN48H_wr_block(uint8_t *p,unsigned int cnt)
 /**************************************************************************/
 inline void RK043FN48H_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
 {
-
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_rect(x,width,y,height);
+#else
+	(void)x;
+	(void)width;
+	(void)y;
+	(void)height;
+#endif
 }
 
 /**************************************************************************/
@@ -102,7 +120,9 @@ inline void RK043FN48H_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t hei
 /**************************************************************************/
 inline void RK043FN48H_clear(void)
 {
-
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	DispFB_clear();
+#endif
 }
 
 
@@ -116,6 +136,15 @@ void RK043FN48H_init(void)
 	/* Set LCD-Controller to RGB Interface */
 	Display_RGBIF_Init();
 
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+	/* Attach Software Framebuffer,LTDC scans RK043FN48H_FB0 at first */
+	DispFB_init(RK043FN48H_FB0,RK043FN48H_FB1,MAX_X,MAX_Y);
+	if (RK043FN48H_FB1 != NULL) {
+		/* Clear scanned buffer directly,drawing buffer is cleared below */
+		memset(DispFB_front(),0,MAX_X*MAX_Y*sizeof(uint16_t));
+	}
+#endif
+
 	/* Flush Display */
 	Display_clear_if();
 
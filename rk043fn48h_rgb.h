@@ -2,8 +2,8 @@
 /*!
 	@file			rk043fn48h_rgb.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				 	 	 @n
 					Available TFT-LCM are listed below.							 	 	 @n
 					 -STM32F746G-Discovery		(RK043FN48H)	RGB-Interface
@@ -12,13 +12,15 @@
 		2015.08.01	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added software framebuffer backend.
+		2026.10.19	V5.00	Fixed double buffer clear on init.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef RK043FN48H_RGB_H
-#define RK043FN48H_RGB_H 0x0300
+#define RK043FN48H_RGB_H 0x0500
 
 #ifdef __cplusplus
  extern "C" {
@@ -43,6 +45,17 @@
 #define MAX_X				480
 #define MAX_Y				272
 
+/* Software Framebuffer Location (override in MAKEFILE if needed) */
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+ #include "display_fb.h"
+ #ifndef RK043FN48H_FB0
+  #define RK043FN48H_FB0		((uint16_t*)0xC0000000)
+ #endif
+ #ifndef RK043FN48H_FB1
+  #define RK043FN48H_FB1		(RK043FN48H_FB0 + (MAX_X*MAX_Y))
+ #endif
+#endif
+
 /* Display Contol Macros */
 
 
@@ -62,12 +75,21 @@ extern void RK043FN48H_wr_gram(uint16_t gram);
 extern volatile uint32_t ticktime;
 
 /* Macros From Application Layer */
+#ifdef USE_DISPLAY_SOFT_FRAMEBUFFER
+#define Display_init_if			RK043FN48H_init
+#define Display_rect_if 		RK043FN48H_rect
+#define Display_wr_dat_if		RK043FN48H_wr_gram
+#define Display_wr_cmd_if		RK043FN48H_wr_cmd
+#define Display_wr_block_if		RK043FN48H_wr_block
+#define Display_clear_if 		RK043FN48H_clear
+#else
 #define Display_init_if			RK043FN48H_init
 extern void Display_rect_if(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void Display_wr_dat_if(uint16_t gram);
 #define Display_wr_cmd_if		RK043FN48H_wr_cmd
 extern void Display_wr_block_if(uint8_t* blockdata,unsigned int datacount);
 extern void Display_clear_if(void);
+#endif
 
 #ifdef __cplusplus
 }
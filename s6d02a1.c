@@ -2,8 +2,8 @@
 /*!
 	@file			s6d02a1.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive UT18022B0-00 TFT module(4-Wire,8bitSerial only).
 
@@ -11,6 +11,8 @@
 		2013.11.30	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V5.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -20,7 +22,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "s6d02a1.h"
 /* check header file version for fool proof */
-#if S6D02A1_H != 0x0300
+#if S6D02A1_H != 0x0500
 #error "header file version is not correspond!"
 #endif
 
@@ -312,6 +314,37 @@ inline void S6D02A1_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Set Interface Pixel Format for Following GRAM Data.
+	Used by PixFmt_blit(),returns 0 on success,-1 if not supported.
+*/
+/**************************************************************************/
+int S6D02A1_set_pixfmt(uint8_t fmt)
+{
+	uint8_t colmod;
+
+	switch (fmt) {
+	case PIXFMT_RGB565:
+		colmod = 0x05;				/* 16-bit/pixel R5G6B5 */
+		break;
+	case PIXFMT_RGB444:
+		colmod = 0x03;				/* 12-bit/pixel R4G4B4 */
+		break;
+	case PIXFMT_RGB666:
+		colmod = 0x06;				/* 18-bit/pixel R6G6B6 */
+		break;
+	default:
+		return -1;					/* S6D02A1 has no 8bit/pixel interface format */
+	}
+
+	S6D02A1_wr_cmd(0x3A);				/* Interface Pixel Format */
+	S6D02A1_wr_dat(colmod);
+
+	return 0;
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
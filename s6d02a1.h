@@ -2,8 +2,8 @@
 /*!
 	@file			s6d02a1.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        3.00
-    @date           2023.08.01
+    @version        5.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					It can drive UT18022B0-00 TFT module(4-Wire,8bitSerial only).
 
@@ -11,13 +11,15 @@
 		2013.11.30	V1.00	Stable Release.
 		2023.05.01	V2.00	Removed unused delay function.
 		2023.08.01	V3.00	Revised release.
+		2026.10.19	V4.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V5.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef S6D02A1_H
-#define S6D02A1_H 0x0300
+#define S6D02A1_H 0x0500
 
 #ifdef __cplusplus
  extern "C" {
@@ -29,6 +31,7 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#include "display_pixfmt.h"
 
 /* S6D02A1 unique value */
 /* mst be need for S6D02A1 */
@@ -72,6 +75,7 @@ extern void S6D02A1_wr_gram(uint16_t gram);
 extern void S6D02A1_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void S6D02A1_clear(void);
 extern uint16_t S6D02A1_rd_cmd(uint8_t cmd);
+extern int S6D02A1_set_pixfmt(uint8_t fmt);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -84,6 +88,8 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		S6D02A1_wr_cmd
 #define Display_wr_block_if		S6D02A1_wr_block
 #define Display_clear_if 		S6D02A1_clear
+#define Display_set_pixfmt_if		S6D02A1_set_pixfmt
+#define Display_wr_byte_if		S6D02A1_wr_dat
 
 #ifdef __cplusplus
 }
@@ -2,8 +2,8 @@
 /*!
 	@file			st7735.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        9.00
-    @date           2023.08.01
+    @version        15.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -JD-T18003-T01				(4-wire serial)					@n
@@ -21,6 +21,12 @@
 		2011.10.25	V7.00	Added DMA TransactionSupport.
 		2023.05.01	V8.00	Removed unused delay function.
 		2023.08.01	V9.00	Revised release.
+		2026.10.19 V10.00	Added runtime rotation and column-major block write.
+		2026.10.19 V11.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19 V12.00	Added partial/idle low-power mode.
+		2026.10.19 V13.00	Added frame rate levels for adaptive refresh.
+		2026.10.19 V14.00	Moved format blit to PixFmt_blit().
+		2026.10.19 V15.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -30,15 +36,31 @@
 /* Includes ------------------------------------------------------------------*/
 #include "st7735.h"
 /* check header file version for fool proof */
-#if ST7735_H != 0x0900
+#if ST7735_H != 0x1500
 #error "header file version is not correspond!"
 #endif
 
 /* Defines -------------------------------------------------------------------*/
 
 /* Variables -----------------------------------------------------------------*/
+/* Display Mode */
+uint8_t ST7735_mode = ST7735_MODE_NORMAL;
+/* Sleep/Wake State */
+static uint8_t  st7735_asleep;
+static uint32_t st7735_slpout_tick;				/* ticktime(1ms) at Sleep Out */
+/* Runtime Rotation State */
+static uint8_t st7735_madctl  = MADVAL;
+static uint8_t st7735_ofs_col = OFS_COL;
+static uint8_t st7735_ofs_raw = OFS_RAW;
+uint16_t ST7735_max_x = MAX_X;
+uint16_t ST7735_max_y = MAX_Y;
 
 /* Constants -----------------------------------------------------------------*/
+/* Frame Rate Levels,RTNA/FPA/BPA of FRMCTR1(B1h),Hz for 160 lines */
+static const uint8_t st7735_frc[ST7735_FRAME_RATES][3] = {
+	{0x0F,0x3F,0x3F}, {0x0F,0x25,0x18}, {0x08,0x25,0x18}, {0x04,0x25,0x18}
+};
+const uint8_t ST7735_frame_rate_hz[ST7735_FRAME_RATES] = { 33, 43, 53, 62 };
 
 /* Function prototypes -------------------------------------------------------*/
 
@@ -279,16 +301,16 @@ inline void ST7735_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
 	/* Set CAS Address */
 	ST7735_wr_cmd(CASET); 
 	ST7735_wr_dat(0);
-	ST7735_wr_dat(OFS_COL + x);
+	ST7735_wr_dat(st7735_ofs_col + x);
 	ST7735_wr_dat(0);
-	ST7735_wr_dat(OFS_COL + width);
+	ST7735_wr_dat(st7735_ofs_col + width);
 	
 	/* Set RAS Address */
 	ST7735_wr_cmd(RASET);
 	ST7735_wr_dat(0);
-	ST7735_wr_dat(OFS_RAW + y); 
+	ST7735_wr_dat(st7735_ofs_raw + y); 
 	ST7735_wr_dat(0);
-	ST7735_wr_dat(OFS_RAW + height); 
+	ST7735_wr_dat(st7735_ofs_raw + height); 
 	
 	/* Write RAM */
 	ST7735_wr_cmd(RAMWR);
@@ -303,7 +325,7 @@ inline void ST7735_clear(void)
 {
 	volatile uint32_t n;
 
-	ST7735_rect(0,MAX_X-1,0,MAX_Y-1);
+	ST7735_rect(0,ST7735_max_x-1,0,ST7735_max_y-1);
 	n = (MAX_X) * (MAX_Y);
 
 	do {
@@ -313,6 +335,182 @@ inline void ST7735_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Set Display Rotation(0/90/180/270 degree).
+*/
+/**************************************************************************/
+void ST7735_set_rotation(uint16_t deg)
+{
+	static const uint8_t madrot[4] = { 0, MADCTL_MV|MADCTL_MX, MADCTL_MX|MADCTL_MY, MADCTL_MV|MADCTL_MY };
+	uint8_t r = (uint8_t)((deg / 90) & 3);
+
+	st7735_madctl = MADVAL ^ madrot[r];
+	ST7735_wr_cmd(MADCTL);
+	ST7735_wr_dat(st7735_madctl);
+
+	if (r & 1) {
+		ST7735_max_x   = MAX_Y;
+		ST7735_max_y   = MAX_X;
+		st7735_ofs_col = OFS_RAW;
+		st7735_ofs_raw = OFS_COL;
+	}
+	else {
+		ST7735_max_x   = MAX_X;
+		ST7735_max_y   = MAX_Y;
+		st7735_ofs_col = OFS_COL;
+		st7735_ofs_raw = OFS_RAW;
+	}
+}
+
+/**************************************************************************/
+/*! 
+    Write Column-Major Block Data.
+	Exchange Row/Column(MV) only while this blit,no transpose needed.
+*/
+/**************************************************************************/
+void ST7735_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt)
+{
+	uint8_t ofs;
+
+	ST7735_wr_cmd(MADCTL);
+	ST7735_wr_dat(st7735_madctl ^ MADCTL_MV);
+
+	ofs = st7735_ofs_col; st7735_ofs_col = st7735_ofs_raw; st7735_ofs_raw = ofs;
+	ST7735_rect(y,height,x,width);
+	ofs = st7735_ofs_col; st7735_ofs_col = st7735_ofs_raw; st7735_ofs_raw = ofs;
+
+	ST7735_wr_block(p,cnt);
+
+	ST7735_wr_cmd(MADCTL);
+	ST7735_wr_dat(st7735_madctl);
+}
+
+
+/**************************************************************************/
+/*! 
+    Set Interface Pixel Format for Following GRAM Data.
+	Used by PixFmt_blit(),returns 0 on success,-1 if not supported.
+*/
+/**************************************************************************/
+int ST7735_set_pixfmt(uint8_t fmt)
+{
+	uint8_t colmod;
+
+	switch (fmt) {
+	case PIXFMT_RGB565:
+		colmod = 0x05;				/* 16-bit/pixel R5G6B5 */
+		break;
+	case PIXFMT_RGB444:
+		colmod = 0x03;				/* 12-bit/pixel R4G4B4 */
+		break;
+	case PIXFMT_RGB666:
+		colmod = 0x06;				/* 18-bit/pixel R6G6B6 */
+		break;
+	default:
+		return -1;					/* ST7735 has no 8bit/pixel interface format */
+	}
+
+	ST7735_wr_cmd(COLMOD);				/* Interface Pixel Format */
+	ST7735_wr_dat(colmod);
+
+	return 0;
+}
+
+
+/**************************************************************************/
+/*! 
+    Enter Partial and Idle(8 colours) Mode.
+	top/bottom are panel rows at rotation 0,rows outside are not driven.
+	Called again in this mode,only the area is moved.
+*/
+/**************************************************************************/
+void ST7735_partial_idle(uint16_t top, uint16_t bottom)
+{
+	ST7735_wr_cmd(0x30);				/* Partial Area */
+	ST7735_wr_dat((OFS_RAW + top)>>8);
+	ST7735_wr_dat(OFS_RAW + top);
+	ST7735_wr_dat((OFS_RAW + bottom)>>8);
+	ST7735_wr_dat(OFS_RAW + bottom);
+
+	if (ST7735_mode == ST7735_MODE_PARTIAL_IDLE) return;
+
+	ST7735_wr_cmd(0x12);				/* Partial Mode ON */
+	ST7735_wr_cmd(0x39);				/* Idle Mode ON */
+
+	ST7735_mode = ST7735_MODE_PARTIAL_IDLE;
+}
+
+/**************************************************************************/
+/*! 
+    Back to Normal Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ST7735_normal(void)
+{
+	if (ST7735_mode == ST7735_MODE_NORMAL) return;
+
+	ST7735_wr_cmd(0x13);				/* Normal Display Mode ON */
+	ST7735_wr_cmd(0x38);				/* Idle Mode OFF */
+
+	ST7735_mode = ST7735_MODE_NORMAL;
+}
+
+/**************************************************************************/
+/*! 
+    Enter Sleep Mode,GRAM and registers are kept.
+	Sleep In MUST be 120ms or more after Sleep Out.
+*/
+/**************************************************************************/
+void ST7735_sleep(void)
+{
+	uint32_t t;
+
+	if (st7735_asleep) return;
+
+	t = ticktime - st7735_slpout_tick;
+	if (t < 120) _delay_ms(120 - t);	/* only the rest of 120ms */
+
+	ST7735_wr_cmd(DISPOFF);				/* Display OFF */
+	ST7735_wr_cmd(SLPIN);				/* Sleep IN */
+	_delay_ms(5);						/* wait 5ms before next command */
+
+	st7735_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Sleep Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ST7735_wake(void)
+{
+	if (!st7735_asleep) return;
+
+	ST7735_wr_cmd(SLPOUT);				/* Sleep OUT */
+	_delay_ms(120);						/* wait 120ms before next command */
+	ST7735_wr_cmd(DISPON);				/* Display ON */
+
+	st7735_slpout_tick = ticktime;
+	st7735_asleep = 0;
+}
+
+/**************************************************************************/
+/*! 
+    Set Frame Rate Level in Normal Mode,0 = slowest.
+*/
+/**************************************************************************/
+void ST7735_set_frame_rate(uint8_t level)
+{
+	if (level >= ST7735_FRAME_RATES) level = ST7735_FRAME_RATES - 1;
+
+	ST7735_wr_cmd(FRMCTR1);				/* Frame Rate Control(Normal Mode) */
+	ST7735_wr_dat(st7735_frc[level][0]);	/* RTNA */
+	ST7735_wr_dat(st7735_frc[level][1]);	/* FPA */
+	ST7735_wr_dat(st7735_frc[level][2]);	/* BPA */
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -460,6 +658,12 @@ void ST7735_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+	ST7735_set_rotation(ST7735_ROTATION);
+
+	ST7735_mode = ST7735_MODE_NORMAL;
+	st7735_asleep = 0;
+	st7735_slpout_tick = ticktime;
+
 	ST7735_clear();
 
 #if 0	/* test code RED */
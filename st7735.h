@@ -2,8 +2,8 @@
 /*!
 	@file			st7735.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        9.00
-    @date           2023.08.01
+    @version        15.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -JD-T18003-T01				(4-wire serial)					@n
@@ -21,13 +21,19 @@
 		2011.10.25	V7.00	Added DMA TransactionSupport.
 		2023.05.01	V8.00	Removed unused delay function.
 		2023.08.01	V9.00	Revised release.
+		2026.10.19 V10.00	Added runtime rotation and column-major block write.
+		2026.10.19 V11.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19 V12.00	Added partial/idle low-power mode.
+		2026.10.19 V13.00	Added frame rate levels for adaptive refresh.
+		2026.10.19 V14.00	Moved format blit to PixFmt_blit().
+		2026.10.19 V15.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ST7735_H
-#define ST7735_H 0x0900
+#define ST7735_H 0x1500
 
 #ifdef __cplusplus
  extern "C" {
@@ -39,6 +45,7 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#include "display_pixfmt.h"
 
 /* ST7735 Unique Value		*/
 /* MUST be need for ST7735	*/
@@ -152,9 +159,36 @@
 /* If U want to true device id,uncomment this */
 #define ST7735_SPI_4WIRE_READID_IGNORE
 
+/* MADCTL Bits */
+#define MADCTL_MY	(1<<7)
+#define MADCTL_MX	(1<<6)
+#define MADCTL_MV	(1<<5)
+#define MADCTL_ML	(1<<4)
+#define MADCTL_BGR	(1<<3)
+#define MADCTL_MH	(1<<2)
+
+/* Default Rotation after Initialize (0/90/180/270) */
+#ifndef ST7735_ROTATION
+ #define ST7735_ROTATION	0
+#endif
+
+/* Display Mode */
+#define ST7735_MODE_NORMAL			0
+#define ST7735_MODE_PARTIAL_IDLE	1
+
+/* Frame Rate Levels */
+#define ST7735_FRAME_RATES		4
+
 /* Display Control Functions Prototype */
 extern void ST7735_reset(void);
 extern void ST7735_init(void);
+extern void ST7735_set_frame_rate(uint8_t level);
+extern const uint8_t ST7735_frame_rate_hz[ST7735_FRAME_RATES];
+extern void ST7735_partial_idle(uint16_t top, uint16_t bottom);
+extern void ST7735_normal(void);
+extern void ST7735_sleep(void);
+extern void ST7735_wake(void);
+extern uint8_t ST7735_mode;
 extern void ST7735_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void ST7735_wr_cmd(uint8_t cmd);
 extern void ST7735_wr_dat(uint8_t dat);
@@ -162,6 +196,11 @@ extern void ST7735_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ST7735_clear(void);
 extern void ST7735_wr_gram(uint16_t gram);
 extern uint8_t ST7735_rd_cmd(uint8_t cmd);
+extern void ST7735_set_rotation(uint16_t deg);
+extern void ST7735_wr_block_colmajor(uint32_t x, uint32_t width, uint32_t y, uint32_t height, uint8_t* p, unsigned int cnt);
+extern uint16_t ST7735_max_x;
+extern uint16_t ST7735_max_y;
+extern int ST7735_set_pixfmt(uint8_t fmt);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -174,6 +213,20 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ST7735_wr_cmd
 #define Display_wr_block_if		ST7735_wr_block
 #define Display_clear_if 		ST7735_clear
+#define Display_set_frame_rate_if	ST7735_set_frame_rate
+#define Display_frame_rate_hz_if	ST7735_frame_rate_hz
+#define Display_frame_rates_if		ST7735_FRAME_RATES
+#define Display_partial_idle_if	ST7735_partial_idle
+#define Display_normal_if		ST7735_normal
+#define Display_sleep_if		ST7735_sleep
+#define Display_wake_if			ST7735_wake
+#define Display_mode_if			ST7735_mode
+#define Display_set_pixfmt_if		ST7735_set_pixfmt
+#define Display_wr_byte_if		ST7735_wr_dat
+#define Display_set_rotation_if		ST7735_set_rotation
+#define Display_wr_block_colmajor_if	ST7735_wr_block_colmajor
+#define Display_max_x_if		ST7735_max_x
+#define Display_max_y_if		ST7735_max_y
 
 #ifdef __cplusplus
 }
@@ -2,8 +2,8 @@
 /*!
 	@file			st7735r.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2023.08.01
+    @version        6.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -JD-T18003-T01				(8bit4wire serial only)			@n
@@ -13,6 +13,8 @@
 		2011.10.25	V2.00	Added DMA TransactionSupport.
 		2023.05.01	V3.00	Removed unused delay function.
 		2023.08.01	V4.00	Revised release.
+		2026.10.19	V5.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V6.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -22,7 +24,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "st7735r.h"
 /* check header file version for fool proof */
-#if ST7735R_H != 0x0400
+#if ST7735R_H != 0x0600
 #error "header file version is not correspond!"
 #endif
 
@@ -287,6 +289,37 @@ inline void ST7735R_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Set Interface Pixel Format for Following GRAM Data.
+	Used by PixFmt_blit(),returns 0 on success,-1 if not supported.
+*/
+/**************************************************************************/
+int ST7735R_set_pixfmt(uint8_t fmt)
+{
+	uint8_t colmod;
+
+	switch (fmt) {
+	case PIXFMT_RGB565:
+		colmod = 0x05;				/* 16-bit/pixel R5G6B5 */
+		break;
+	case PIXFMT_RGB444:
+		colmod = 0x03;				/* 12-bit/pixel R4G4B4 */
+		break;
+	case PIXFMT_RGB666:
+		colmod = 0x06;				/* 18-bit/pixel R6G6B6 */
+		break;
+	default:
+		return -1;					/* ST7735R has no 8bit/pixel interface format */
+	}
+
+	ST7735R_wr_cmd(COLMOD);				/* Interface Pixel Format */
+	ST7735R_wr_dat(colmod);
+
+	return 0;
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -2,8 +2,8 @@
 /*!
 	@file			st7735r.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2023.08.01
+    @version        6.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -JD-T18003-T01				(8bit4wire serial only)			@n
@@ -13,13 +13,15 @@
 		2011.10.25	V2.00	Added DMA TransactionSupport.
 		2023.05.01	V3.00	Removed unused delay function.
 		2023.08.01	V4.00	Revised release.
+		2026.10.19	V5.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V6.00	Moved format blit to PixFmt_blit().
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ST7735R_H
-#define ST7735R_H 0x0400
+#define ST7735R_H 0x0600
 
 #ifdef __cplusplus
  extern "C" {
@@ -31,6 +33,7 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#include "display_pixfmt.h"
 
 /* ST7735R Unique Value		*/
 /* MUST be need for JD-T18003-T01 */
@@ -136,6 +139,7 @@ extern void ST7735R_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ST7735R_clear(void);
 extern uint8_t ST7735R_rd_cmd(uint8_t cmd);
 extern void ST7735R_wr_gram(uint16_t gram);
+extern int ST7735R_set_pixfmt(uint8_t fmt);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -148,6 +152,8 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ST7735R_wr_cmd
 #define Display_wr_block_if		ST7735R_wr_block
 #define Display_clear_if 		ST7735R_clear
+#define Display_set_pixfmt_if		ST7735R_set_pixfmt
+#define Display_wr_byte_if		ST7735R_wr_dat
 
 #ifdef __cplusplus
 }
@@ -2,8 +2,8 @@
 /*!
 	@file			st7789v2.c
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2024.08.01
+    @version        9.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -ATM0130B3				(ST7789V2)	(8bit4wire serial only)
@@ -13,6 +13,11 @@
 		2023.08.01	V2.00	Revised release.
 		2023.09.01	V3.00	Fixed DDRAM address set.
 		2024.08.01	V4.00	Fixed unused parameter fix.
+		2026.10.19	V5.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V6.00	Added partial/idle low-power mode.
+		2026.10.19	V7.00	Added frame rate levels for adaptive refresh.
+		2026.10.19	V8.00	Moved format blit to PixFmt_blit().
+		2026.10.19	V9.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
@@ -22,7 +27,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "st7789v2.h"
 /* check header file version for fool proof */
-#if ST7789V2_H != 0x0400
+#if ST7789V2_H != 0x0900
 #error "header file version is not correspond!"
 #endif
 
@@ -32,8 +37,16 @@
 #endif
 
 /* Variables -----------------------------------------------------------------*/
+/* Display Mode */
+uint8_t ST7789V2_mode = ST7789V2_MODE_NORMAL;
+/* Sleep/Wake State */
+static uint8_t  st7789v2_asleep;
+static uint32_t st7789v2_slpout_tick;				/* ticktime(1ms) at Sleep Out */
 
 /* Constants -----------------------------------------------------------------*/
+/* Frame Rate Levels,RTNA of FRCTRL2(C6h) with default porch */
+static const uint8_t st7789v2_frc[ST7789V2_FRAME_RATES] = { 0x1F, 0x15, 0x0F };
+const uint8_t ST7789V2_frame_rate_hz[ST7789V2_FRAME_RATES] = { 39, 50, 60 };
 
 /* Function prototypes -------------------------------------------------------*/
 
@@ -291,6 +304,128 @@ inline void ST7789V2_clear(void)
 }
 
 
+/**************************************************************************/
+/*! 
+    Set Interface Pixel Format for Following GRAM Data.
+	Used by PixFmt_blit(),returns 0 on success,-1 if not supported.
+*/
+/**************************************************************************/
+int ST7789V2_set_pixfmt(uint8_t fmt)
+{
+	uint8_t colmod;
+
+	switch (fmt) {
+	case PIXFMT_RGB565:
+		colmod = 0x55;				/* 16-bit/pixel R5G6B5 */
+		break;
+	case PIXFMT_RGB444:
+		colmod = 0x53;				/* 12-bit/pixel R4G4B4 */
+		break;
+	case PIXFMT_RGB666:
+		colmod = 0x66;				/* 18-bit/pixel R6G6B6 */
+		break;
+	default:
+		return -1;					/* ST7789V2 has no 8bit/pixel interface format */
+	}
+
+	ST7789V2_wr_cmd(COLMOD);				/* Interface Pixel Format */
+	ST7789V2_wr_dat(colmod);
+
+	return 0;
+}
+
+
+/**************************************************************************/
+/*! 
+    Enter Partial and Idle(8 colours) Mode.
+	top/bottom are panel rows at rotation 0,rows outside are not driven.
+	Called again in this mode,only the area is moved.
+*/
+/**************************************************************************/
+void ST7789V2_partial_idle(uint16_t top, uint16_t bottom)
+{
+	ST7789V2_wr_cmd(0x30);				/* Partial Area */
+	ST7789V2_wr_dat((OFS_RAW + top)>>8);
+	ST7789V2_wr_dat(OFS_RAW + top);
+	ST7789V2_wr_dat((OFS_RAW + bottom)>>8);
+	ST7789V2_wr_dat(OFS_RAW + bottom);
+
+	if (ST7789V2_mode == ST7789V2_MODE_PARTIAL_IDLE) return;
+
+	ST7789V2_wr_cmd(0x12);				/* Partial Mode ON */
+	ST7789V2_wr_cmd(0x39);				/* Idle Mode ON */
+
+	ST7789V2_mode = ST7789V2_MODE_PARTIAL_IDLE;
+}
+
+/**************************************************************************/
+/*! 
+    Back to Normal Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ST7789V2_normal(void)
+{
+	if (ST7789V2_mode == ST7789V2_MODE_NORMAL) return;
+
+	ST7789V2_wr_cmd(0x13);				/* Normal Display Mode ON */
+	ST7789V2_wr_cmd(0x38);				/* Idle Mode OFF */
+
+	ST7789V2_mode = ST7789V2_MODE_NORMAL;
+}
+
+/**************************************************************************/
+/*! 
+    Enter Sleep Mode,GRAM and registers are kept.
+	Sleep In MUST be 120ms or more after Sleep Out.
+*/
+/**************************************************************************/
+void ST7789V2_sleep(void)
+{
+	uint32_t t;
+
+	if (st7789v2_asleep) return;
+
+	t = ticktime - st7789v2_slpout_tick;
+	if (t < 120) _delay_ms(120 - t);	/* only the rest of 120ms */
+
+	ST7789V2_wr_cmd(DISPOFF);			/* Display OFF */
+	ST7789V2_wr_cmd(SLPIN);				/* Sleep IN */
+	_delay_ms(5);						/* wait 5ms before next command */
+
+	st7789v2_asleep = 1;
+}
+
+/**************************************************************************/
+/*! 
+    Exit Sleep Mode without Re-initialize.
+*/
+/**************************************************************************/
+void ST7789V2_wake(void)
+{
+	if (!st7789v2_asleep) return;
+
+	ST7789V2_wr_cmd(SLPOUT);			/* Sleep OUT */
+	_delay_ms(5);						/* wait 5ms before next command */
+	ST7789V2_wr_cmd(DISPON);			/* Display ON */
+
+	st7789v2_slpout_tick = ticktime;
+	st7789v2_asleep = 0;
+}
+
+/**************************************************************************/
+/*! 
+    Set Frame Rate Level in Normal Mode,0 = slowest.
+*/
+/**************************************************************************/
+void ST7789V2_set_frame_rate(uint8_t level)
+{
+	if (level >= ST7789V2_FRAME_RATES) level = ST7789V2_FRAME_RATES - 1;
+
+	ST7789V2_wr_cmd(0xC6);				/* Frame Rate Control in Normal Mode */
+	ST7789V2_wr_dat(st7789v2_frc[level]);	/* NLA=0,RTNA */
+}
+
+
 /**************************************************************************/
 /*! 
     TFT-LCD Module Initialize.
@@ -416,6 +551,10 @@ void ST7789V2_init(void)
 
 	else { for(;;);} /* Invalid Device Code!! */
 
+	ST7789V2_mode = ST7789V2_MODE_NORMAL;
+	st7789v2_asleep = 0;
+	st7789v2_slpout_tick = ticktime;
+
 	ST7789V2_clear();					/* Clear GRAM */
 
 #if 0	/* test code RED */
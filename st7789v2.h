@@ -2,8 +2,8 @@
 /*!
 	@file			st7789v2.h
 	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
-    @version        4.00
-    @date           2024.08.01
+    @version        9.00
+    @date           2026.10.19
 	@brief          Based on Chan's MCI_OLED@LPC23xx-demo thanks!				@n
 					Available TFT-LCM are listed below.							@n
 					 -ATM0130B3				(ST7789V2)	(8bit4wire serial only)
@@ -13,13 +13,18 @@
 		2023.08.01	V2.00	Revised release.
 		2023.09.01	V3.00	Fixed DDRAM address set.
 		2024.08.01	V4.00	Fixed unused parameter fix.
+		2026.10.19	V5.00	Added reduced colour-depth(RGB444) block write.
+		2026.10.19	V6.00	Added partial/idle low-power mode.
+		2026.10.19	V7.00	Added frame rate levels for adaptive refresh.
+		2026.10.19	V8.00	Moved format blit to PixFmt_blit().
+		2026.10.19	V9.00	Added sleep/wake keeping GRAM.
 
     @section LICENSE
 		BSD License. See Copyright.txt
 */
 /********************************************************************************/
 #ifndef ST7789V2_H
-#define ST7789V2_H 0x0400
+#define ST7789V2_H 0x0900
 
 #ifdef __cplusplus
  extern "C" {
@@ -31,6 +36,7 @@
 
 /* display includes */
 #include "display_if_basis.h"
+#include "display_pixfmt.h"
 
 /* ST7789V2 unique value */
 /* Select TFT-LCD module model */
@@ -124,9 +130,23 @@
 /* If U want to true device id,uncomment this */
 #define ST7789V2_SPI_4WIRE_READID_IGNORE
 
+/* Display Mode */
+#define ST7789V2_MODE_NORMAL			0
+#define ST7789V2_MODE_PARTIAL_IDLE	1
+
+/* Frame Rate Levels */
+#define ST7789V2_FRAME_RATES		3
+
 /* Display Control Functions Prototype */
 extern void ST7789V2_reset(void);
 extern void ST7789V2_init(void);
+extern void ST7789V2_set_frame_rate(uint8_t level);
+extern const uint8_t ST7789V2_frame_rate_hz[ST7789V2_FRAME_RATES];
+extern void ST7789V2_partial_idle(uint16_t top, uint16_t bottom);
+extern void ST7789V2_normal(void);
+extern void ST7789V2_sleep(void);
+extern void ST7789V2_wake(void);
+extern uint8_t ST7789V2_mode;
 extern void ST7789V2_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height);
 extern void ST7789V2_wr_cmd(uint8_t cmd);
 extern void ST7789V2_wr_dat(uint8_t dat);
@@ -134,6 +154,7 @@ extern void ST7789V2_wr_block(uint8_t* blockdata,unsigned int datacount);
 extern void ST7789V2_clear(void);
 extern uint8_t ST7789V2_rd_cmd(uint8_t cmd);
 extern void ST7789V2_wr_gram(uint16_t gram);
+extern int ST7789V2_set_pixfmt(uint8_t fmt);
 
 /* For Display Module's Delay Routine */
 #define Display_timerproc_if()	ticktime++
@@ -146,6 +167,16 @@ extern volatile uint32_t ticktime;
 #define Display_wr_cmd_if		ST7789V2_wr_cmd
 #define Display_wr_block_if		ST7789V2_wr_block
 #define Display_clear_if 		ST7789V2_clear
+#define Display_set_frame_rate_if	ST7789V2_set_frame_rate
+#define Display_frame_rate_hz_if	ST7789V2_frame_rate_hz
+#define Display_frame_rates_if		ST7789V2_FRAME_RATES
+#define Display_partial_idle_if	ST7789V2_partial_idle
+#define Display_normal_if		ST7789V2_normal
+#define Display_sleep_if		ST7789V2_sleep
+#define Display_wake_if			ST7789V2_wake
+#define Display_mode_if			ST7789V2_mode
+#define Display_set_pixfmt_if		ST7789V2_set_pixfmt
+#define Display_wr_byte_if		ST7789V2_wr_dat
 
 #ifdef __cplusplus
 }
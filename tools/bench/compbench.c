@@ -0,0 +1,162 @@
+/********************************************************************************/
+/*!
+	@file			compbench.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Compositor Per-Layer Cost Benchmark(host tool).			@n
+					usage: compbench [frames]									@n
+					build: cc -O2 -DDCOMP_LAYER_TIME -I../.. compbench.c	@n
+					 ../../display_comp.c -o compbench,					@n
+					 add -DDCOMP_NO_SIMD for plain C.						@n
+					"own" is the blend time of the layer itself as the top
+					of the stack,"marginal" is the frame time against one
+					layer fewer(a covering layer can make it negative),
+					"all" are the layer counts with every layer stacked.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Report own time,pixels and skipped per layer.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "display_comp.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define W					DCOMP_MAX_WIDTH
+#define H					240
+#define LAYERS				6
+
+/* Variables -----------------------------------------------------------------*/
+static uint16_t bg[H][W], fg[H/2][W/2], icon[64][64];
+static uint8_t  mask[H/2][W/2];
+static volatile uint32_t sink;
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const lname[LAYERS] = {
+	"RGB565 opaque", "RGB565 alpha 128", "SOLID alpha 64",
+	"ARGB4444", "A8 mask", "SOLID opaque(covers)"
+};
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Sink Driver Entry Points.
+*/
+/**************************************************************************/
+static void b_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	sink += x + width + y + height;
+}
+
+static void b_wr_gram(uint16_t gram)
+{
+	sink += gram;
+}
+
+static void b_wr_block(uint8_t* p, unsigned int cnt)
+{
+	sink += p[0] + p[cnt - 1];
+}
+
+/**************************************************************************/
+/*!
+    Monotonic Time in Nanoseconds.
+*/
+/**************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    Layer Clock for DCOMP_LAYER_TIME,in Nanoseconds.
+*/
+/**************************************************************************/
+uint32_t DispComp_clock(void)
+{
+	return (uint32_t)now_ns();
+}
+
+/**************************************************************************/
+/*!
+    Time n Frames with First k Layers,returns ns per frame.
+*/
+/**************************************************************************/
+static double run(const DispComp_Layer_t* src, DispComp_Layer_t* l, uint8_t k, uint32_t n)
+{
+	uint64_t t;
+	uint32_t i;
+
+	memcpy(l, src, sizeof(DispComp_Layer_t) * LAYERS);
+	t = now_ns();
+	for (i = 0; i < n; i++) DispComp_flush(l, k, 0, 0, W - 1, H - 1);
+	t = now_ns() - t;
+
+	return (double)t / n;
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispOps_t ops = { b_rect, b_wr_gram, b_wr_block, NULL, NULL, NULL, NULL, NULL };
+	DispComp_Layer_t l[LAYERS] = {
+		{ DCOMP_RGB565,	  255, 0,	   0,	   0,	   W,	  H,	 bg,   W, 0, 0, 0 },
+		{ DCOMP_RGB565,	  128, 0,	   W/4,	   H/4,	   W/2,	  H/2,	 fg,   W/2, 0, 0, 0 },
+		{ DCOMP_SOLID,	  64,  0xF800, 0,	   H/3,	   W,	  H/3,	 NULL, 0, 0, 0, 0 },
+		{ DCOMP_ARGB4444, 255, 0,	   16,	   16,	   64,	  64,	 icon, 64, 0, 0, 0 },
+		{ DCOMP_A8,		  200, 0x07E0, W/2,	   H/2,	   W/2,	  H/2,	 mask, W/2, 0, 0, 0 },
+		{ DCOMP_SOLID,	  255, 0x001F, 0,	   0,	   W,	  H,	 NULL, 0, 0, 0, 0 },
+	};
+	DispComp_Layer_t all[LAYERS],part[LAYERS];
+	uint32_t n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+	uint32_t i,j,px;
+	double t,own,prev = 0;
+
+	for (j = 0; j < H; j++)	  for (i = 0; i < W; i++)	bg[j][i]   = (uint16_t)rand();
+	for (j = 0; j < H/2; j++) for (i = 0; i < W/2; i++) fg[j][i]   = (uint16_t)rand();
+	for (j = 0; j < H/2; j++) for (i = 0; i < W/2; i++) mask[j][i] = (uint8_t)rand();
+	for (j = 0; j < 64; j++)  for (i = 0; i < 64; i++)	icon[j][i] = (uint16_t)rand();
+
+	if (!n) n = 1;
+	DispComp_init(&ops);
+
+#ifdef DCOMP_USE_SIMD
+	printf("%ux%u,%u frames,SIMD\n", W, H, n);
+#else
+	printf("%ux%u,%u frames,plain C\n", W, H, n);
+#endif
+	printf("all layers %.0f ns/frame\n", run(l, all, LAYERS, n));
+	printf("%-22s %8s %12s %10s %12s %10s %10s\n", "layer", "pixels",
+		   "own ns/frame", "own ns/px", "marginal ns", "all pixels", "all skip");
+
+	for (i = 1; i <= LAYERS; i++) {
+		t   = run(l, part, (uint8_t)i, n);
+		px  = part[i - 1].pixels / n;
+		own = (double)part[i - 1].ticks / n;
+		printf("%-22s %8u %12.0f %10.2f %12.0f %10u %10u\n", lname[i - 1], px, own,
+			   px ? own / px : 0.0, t - prev, all[i - 1].pixels / n, all[i - 1].skipped / n);
+		prev = t;
+	}
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,248 @@
+/********************************************************************************/
+/*!
+	@file			glyphbench.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Glyph String Chars/Sec Benchmark(host tool).				@n
+					usage: glyphbench [strings]									@n
+					build: cc -O2 -I../.. glyphbench.c ../../display_glyph.c	@n
+					 ../../display_trace.c ../../display_predict.c			@n
+					 -o glyphbench												@n
+					DispGlyph_string against naive per-pixel wr_gram drawing
+					(one window per glyph,blend per pixel) for 1/2/4bpp.
+					Bus calls of one string are traced as a DCS controller
+					(16bit parallel,8bit SPI) and costed by DispPredict
+					FSMC/SPI/GPIO profiles,bus-bound chars/sec per bus.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added bus-bound chars/sec per bus profile.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "display_glyph.h"
+#include "display_predict.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define GW					8
+#define GH					16
+#define FIRST				0x20
+#define LAST				0x7E
+#define GLYPHS				(LAST - FIRST + 1)
+#define FG					0xFFFF
+#define BG					0x0010
+#define TRACE_SIZE			(1u << 20)
+#define BUSES				3
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  bitmap[GLYPHS * GH * GW / 2];		/* enough for 4bpp */
+static uint32_t calls;
+static volatile uint32_t sink;
+static uint8_t  trace[TRACE_SIZE];
+static uint8_t  tracing,bus8;		/* trace calls,8bit SPI framing */
+static DispPredict_Profile_t prof[BUSES];
+
+/* Constants -----------------------------------------------------------------*/
+static const char text[] = "The quick brown fox jumps over the lazy dog";
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Trace Transfers as a DCS Controller.
+	SPI frames each call by CS,parallel bus keeps CS low.
+*/
+/**************************************************************************/
+static void t_cmd(uint8_t cmd)
+{
+	if (bus8) DispTrace_pin(DTRACE_PIN_CS, 0);
+	DispTrace_pin(DTRACE_PIN_DC, 0);
+	DispTrace_event(DTRACE_CMD, cmd);
+	DispTrace_pin(DTRACE_PIN_DC, 1);
+	if (bus8) DispTrace_pin(DTRACE_PIN_CS, 1);
+}
+
+static void t_dat(const uint8_t* p, uint32_t bytes, uint8_t pixels)
+{
+	uint32_t i;
+
+	if (bus8) DispTrace_pin(DTRACE_PIN_CS, 0);
+	for (i = 0; i < bytes; i += (pixels && !bus8) ? 2 : 1) {
+		DispTrace_event(DTRACE_DAT, (pixels && !bus8) ? (uint16_t)(p[i] << 8 | p[i + 1]) : p[i]);
+	}
+	if (bus8) DispTrace_pin(DTRACE_PIN_CS, 1);
+}
+
+/**************************************************************************/
+/*!
+    Counting Sink Driver Entry Points.
+*/
+/**************************************************************************/
+static void b_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	uint8_t a[4];
+
+	sink += x + width + y + height;
+	calls++;
+	if (!tracing) return;
+
+	a[0] = (uint8_t)(x >> 8); a[1] = (uint8_t)x; a[2] = (uint8_t)(width >> 8); a[3] = (uint8_t)width;
+	t_cmd(0x2A); t_dat(a, 4, 0);
+	a[0] = (uint8_t)(y >> 8); a[1] = (uint8_t)y; a[2] = (uint8_t)(height >> 8); a[3] = (uint8_t)height;
+	t_cmd(0x2B); t_dat(a, 4, 0);
+	t_cmd(0x2C);
+}
+
+static void b_wr_gram(uint16_t gram)
+{
+	uint8_t a[2];
+
+	sink += gram;
+	calls++;
+	if (!tracing) return;
+
+	a[0] = (uint8_t)(gram >> 8); a[1] = (uint8_t)gram;
+	t_dat(a, 2, 1);
+}
+
+static void b_wr_block(uint8_t* p, unsigned int cnt)
+{
+	sink += p[0] + p[cnt - 1];
+	calls++;
+	if (tracing) t_dat(p, cnt, 1);
+}
+
+/**************************************************************************/
+/*!
+    Monotonic Time in Nanoseconds.
+*/
+/**************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    Naive Baseline,one window per glyph and one wr_gram per pixel.
+*/
+/**************************************************************************/
+static void naive_string(uint16_t x, uint16_t y, const DispFont_t* font, const char* str, const DispOps_t* ops)
+{
+	uint32_t i,j,v,a,r,g,b,stride;
+	const uint8_t* p;
+	uint8_t gw;
+
+	for (; *str; str++) {
+		p = DispGlyph_get(font, (uint8_t)*str, &gw);
+		if (!p) continue;
+		stride = ((uint32_t)gw * font->bpp + 7) / 8;
+		ops->rect(x, x + gw - 1, y, y + font->height - 1);
+
+		for (j = 0; j < font->height; j++) {
+			for (i = 0; i < gw; i++) {
+				v = i * font->bpp;
+				v = (p[j * stride + v / 8] >> (8 - font->bpp - v % 8)) & ((1u << font->bpp) - 1);
+				a = v * 15 / ((1u << font->bpp) - 1);
+				r = (((FG >> 11)       ) * a + ((BG >> 11)       ) * (15 - a) + 7) / 15;
+				g = (((FG >>  5) & 0x3F) * a + ((BG >>  5) & 0x3F) * (15 - a) + 7) / 15;
+				b = (((FG      ) & 0x1F) * a + ((BG      ) & 0x1F) * (15 - a) + 7) / 15;
+				ops->wr_gram((uint16_t)((r << 11) | (g << 5) | b));
+			}
+		}
+		x += gw;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Bus-Bound Chars/Sec of One String on Bus Profile b.
+*/
+/**************************************************************************/
+static double bus_rate(uint8_t b, uint8_t naive, const DispFont_t* font, const DispOps_t* ops)
+{
+	DispPredict_Result_t r;
+	uint32_t len;
+
+	bus8	= (b == 1);
+	tracing = 1;
+	DispTrace_begin(trace, TRACE_SIZE);
+	if (naive)	naive_string(0, 0, font, text, ops);
+	else		DispGlyph_string(0, 0, font, text, ops);
+	len = DispTrace_end();
+	tracing = 0;
+
+	DispPredict_cost(&prof[b], DTRACE_DCS, trace, len, 1, &r);
+	return r.frame_ns ? (double)strlen(text) * 1e9 / r.frame_ns : 0.0;
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	static const uint8_t bpps[3] = { 1, 2, 4 };
+	DispOps_t  ops = { b_rect, b_wr_gram, b_wr_block, NULL, NULL, NULL, NULL, NULL };
+	DispFont_t font = { bitmap, NULL, NULL, GW, GH, 1, FIRST, LAST };
+	uint32_t   n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 20000;
+	uint32_t   len = (uint32_t)strlen(text);
+	uint32_t   i,k,b,c1,c2;
+	uint64_t   t1,t2;
+
+	if (!n) n = 1;
+	for (i = 0; i < sizeof(bitmap); i++) bitmap[i] = (uint8_t)rand();
+	DispGlyph_set_colour(FG, BG);
+	DispPredict_fsmc(&prof[0], 168000000, 1, 4);		/* 16bit i8080 */
+	DispPredict_spi(&prof[1], 42000000, 100, 1000);		/* 8bit SPI with DMA */
+	DispPredict_gpio(&prof[2], 60, 20);					/* 16bit bit-bang */
+
+	printf("%ux%u glyphs,%u chars x %u strings\n", GW, GH, len, n);
+	printf("%-5s %14s %14s %8s %12s %12s\n", "bpp", "chars/s", "naive chars/s", "speedup", "calls/str", "naive calls");
+
+	for (k = 0; k < 3; k++) {
+		font.bpp = bpps[k];
+
+		calls = 0;
+		t1 = now_ns();
+		for (i = 0; i < n; i++) DispGlyph_string(0, 0, &font, text, &ops);
+		t1 = now_ns() - t1;
+		c1 = calls / n;
+
+		calls = 0;
+		t2 = now_ns();
+		for (i = 0; i < n; i++) naive_string(0, 0, &font, text, &ops);
+		t2 = now_ns() - t2;
+		c2 = calls / n;
+
+		printf("%-5u %14.0f %14.0f %7.1fx %12u %12u\n", font.bpp,
+			   (double)len * n * 1e9 / t1, (double)len * n * 1e9 / t2, (double)t2 / t1, c1, c2);
+	}
+
+	printf("\nbus-bound chars/s(string/naive)\n%-5s", "bpp");
+	for (b = 0; b < BUSES; b++) printf(" %10s %10s", prof[b].name, "naive");
+	printf("\n");
+	for (k = 0; k < 3; k++) {
+		font.bpp = bpps[k];
+		printf("%-5u", font.bpp);
+		for (b = 0; b < BUSES; b++) printf(" %10.0f %10.0f", bus_rate((uint8_t)b, 0, &font, &ops), bus_rate((uint8_t)b, 1, &font, &ops));
+		printf("\n");
+	}
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,158 @@
+/********************************************************************************/
+/*!
+	@file			rlebench.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          RLE Image Ratio/Throughput Benchmark(host tool).			@n
+					usage: rlebench [loops]										@n
+					build: cc -O2 -I../.. rlebench.c ../../display_rle.c		@n
+					 -o rlebench												@n
+					UI,gradient and noise images are encoded and blitted,
+					bus calls are counted at the sink driver.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "display_rle.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define W					320
+#define H					240
+#define IMAGES				3
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  raw[W * H * 2];
+static uint8_t  enc[W * H * 4];
+static uint32_t calls,bytes;
+static volatile uint32_t sink;
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const iname[IMAGES] = { "UI", "gradient", "noise" };
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Counting Sink Driver Entry Points.
+*/
+/**************************************************************************/
+static void b_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	sink += x + width + y + height;
+	calls++;
+}
+
+static void b_wr_gram(uint16_t gram)
+{
+	sink += gram;
+	calls++;
+	bytes += 2;
+}
+
+static void b_wr_block(uint8_t* p, unsigned int cnt)
+{
+	sink += p[0] + p[cnt - 1];
+	calls++;
+	bytes += cnt;
+}
+
+/**************************************************************************/
+/*!
+    Monotonic Time in Nanoseconds.
+*/
+/**************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    Test Images in RGB565 MSB First.
+*/
+/**************************************************************************/
+static void make(uint8_t kind)
+{
+	uint32_t i,j;
+	uint16_t c;
+
+	for (j = 0; j < H; j++) {
+		for (i = 0; i < W; i++) {
+			switch (kind) {
+			case 0:		/* flat panels,buttons and text-like speckles */
+				c = (j < 24) ? 0x001F : 0xFFFF;
+				if ((j >= 40) && (j < 200) && (i >= 20) && (i < 300)) c = 0xC618;
+				if ((j >= 56) && (j < 184) && ((j % 48) < 32) && (i >= 40) && (i < 140)) c = 0x07E0;
+				if ((j >= 4) && (j < 20) && (i >= 8) && (i < 200) && ((i * 7 + j * 13) % 5 == 0)) c = 0xFFFF;
+				break;
+			case 1:		/* horizontal and vertical gradient */
+				c = (uint16_t)(((i * 31 / (W - 1)) << 11) | ((j * 63 / (H - 1)) << 5) | 0x0008);
+				break;
+			default:
+				c = (uint16_t)rand();
+				break;
+			}
+			raw[(j * W + i) * 2]	 = (uint8_t)(c >> 8);
+			raw[(j * W + i) * 2 + 1] = (uint8_t)c;
+		}
+	}
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispOps_t ops = { b_rect, b_wr_gram, b_wr_block, NULL, NULL, NULL, NULL, NULL };
+	uint32_t  n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 100;
+	uint32_t  i,k,size = 0,blits;
+	uint64_t  te,tb;
+
+	if (!n) n = 1;
+
+	printf("%ux%u RGB565,%u loops\n", W, H, n);
+	printf("%-9s %8s %7s %10s %10s %9s %9s %9s\n",
+		   "image", "bytes", "ratio", "enc ns/px", "blit ns/px", "bus calls", "fills", "directs");
+
+	for (k = 0; k < IMAGES; k++) {
+		make((uint8_t)k);
+
+		te = now_ns();
+		for (i = 0; i < n; i++) size = DispRLE_encode(enc, raw, W * H);
+		te = now_ns() - te;
+
+		calls = bytes = 0;
+		memset(&DispRLE_Stat, 0, sizeof(DispRLE_Stat));
+		tb = now_ns();
+		for (i = 0; i < n; i++) DispRLE_blit(0, W - 1, 0, H - 1, enc, size, &ops);
+		tb = now_ns() - tb;
+		blits = calls / n;
+		if (bytes / n != W * H * 2) printf("%s: bus bytes %u,expected %u\n", iname[k], bytes / n, W * H * 2);
+
+		printf("%-9s %8u %6.1f%% %10.2f %10.2f %9u %9u %9u\n", iname[k], size,
+			   100.0 * size / (W * H * 2),
+			   (double)te / n / (W * H), (double)tb / n / (W * H),
+			   blits, DispRLE_Stat.fills / n, DispRLE_Stat.directs / n);
+	}
+	printf("raw blit is 2 bus calls(rect + one wr_block of %u bytes)\n", W * H * 2);
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
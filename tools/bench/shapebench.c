@@ -0,0 +1,158 @@
+/********************************************************************************/
+/*!
+	@file			shapebench.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Span Primitive Window Setup Benchmark(host tool).			@n
+					usage: shapebench [loops]									@n
+					build: cc -O2 -I../.. shapebench.c ../../display_shape.c	@n
+					 ../../display_fb.c -o shapebench							@n
+					Window setups and pixels per primitive from DispShape_Stat
+					against naive plotting(rect + wr_gram per covered pixel).
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "display_shape.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define W					320
+#define H					240
+#define SHAPES				6
+
+/* Variables -----------------------------------------------------------------*/
+static uint8_t  cover[W * H];
+static uint32_t calls;
+static uint32_t wx0,wx1,wy1,cx,cy;			/* window and cursor */
+static uint8_t  marking;
+static volatile uint32_t sink;
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const sname[SHAPES] = { "line", "rect", "circle", "fill_circle", "round_rect", "fill_poly" };
+static const int16_t star[20] = { 160,40, 184,110, 250,110, 196,150, 216,220, 160,176, 104,220, 124,150, 70,110, 136,110 };
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Counting Sink Driver Entry Points,optionally marks covered pixels.
+*/
+/**************************************************************************/
+static void mark(uint32_t n)
+{
+	while (n--) {
+		if ((cx < W) && (cy < H)) cover[cy * W + cx] = 1;
+		if (++cx > wx1) {
+			cx = wx0;
+			if (++cy > wy1) cy = 0;
+		}
+	}
+}
+
+static void b_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	sink += x + width + y + height;
+	calls++;
+	wx0 = cx = x; wx1 = width;
+	cy = y; wy1 = height;
+}
+
+static void b_wr_gram(uint16_t gram)
+{
+	sink += gram;
+	calls++;
+	if (marking) mark(1);
+}
+
+static void b_wr_block(uint8_t* p, unsigned int cnt)
+{
+	sink += p[0] + p[cnt - 1];
+	calls++;
+	if (marking) mark(cnt / 2);
+}
+
+/**************************************************************************/
+/*!
+    Monotonic Time in Nanoseconds.
+*/
+/**************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    Draw One Primitive.
+*/
+/**************************************************************************/
+static void draw(uint8_t k)
+{
+	switch (k) {
+	case 0:	 DispShape_line(10, 10, 200, 60, 0xFFFF);				break;
+	case 1:	 DispShape_rect(20, 20, 120, 90, 0xF800);				break;
+	case 2:	 DispShape_circle(160, 120, 16, 0x07E0);				break;
+	case 3:	 DispShape_fill_circle(160, 120, 16, 0x001F);			break;
+	case 4:	 DispShape_round_rect(30, 30, 150, 110, 8, 0xFFE0);	break;
+	default: DispShape_fill_poly(star, 10, 0xF81F);					break;
+	}
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispOps_t ops = { b_rect, b_wr_gram, b_wr_block, NULL, NULL, NULL, NULL, NULL };
+	uint32_t  n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 100000;
+	uint32_t  i,k,c,px,wins,pix;
+	uint64_t  t;
+
+	if (!n) n = 1;
+	DispShape_init(&ops, W, H);
+
+	printf("%ux%u panel,%u loops\n", W, H, n);
+	printf("%-12s %8s %8s %8s %12s %12s %9s %10s\n",
+		   "shape", "windows", "calls", "pixels", "naive wins", "naive calls", "wins cut", "ns/shape");
+
+	for (k = 0; k < SHAPES; k++) {
+		/* one counted pass,covered pixels give the naive plot */
+		memset(cover, 0, sizeof(cover));
+		memset(&DispShape_Stat, 0, sizeof(DispShape_Stat));
+		calls	= 0;
+		marking = 1;
+		draw((uint8_t)k);
+		marking = 0;
+		c	 = calls;
+		wins = DispShape_Stat.windows;
+		pix	 = DispShape_Stat.pixels;
+		for (px = 0, i = 0; i < sizeof(cover); i++) px += cover[i];
+
+		t = now_ns();
+		for (i = 0; i < n; i++) draw((uint8_t)k);
+		t = now_ns() - t;
+
+		printf("%-12s %8u %8u %8u %12u %12u %8.1fx %10.1f\n", sname[k],
+			   wins, c, pix, px, px * 2, wins ? (double)px / wins : 0.0, (double)t / n);
+	}
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,187 @@
+/********************************************************************************/
+/*!
+	@file			srvbench.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Display Server Throughput/Latency Benchmark(host tool).	@n
+					usage: srvbench [producers] [requests] [bus_ns_per_pixel]	@n
+					build: cc -O2 -pthread -I../.. srvbench.c					@n
+					 ../../display_server.c ../../display_list.c -o srvbench	@n
+					Producers are pthreads,main thread is the owner task.
+					ticktime counts microseconds,bus cost is busy-waited.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "display_server.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define AREA				16				/* request size(pixels square) */
+
+/* Variables -----------------------------------------------------------------*/
+volatile uint32_t ticktime;
+static volatile int running = 1;
+static uint32_t requests;
+static uint32_t bus_ns;
+static uint64_t bus_pixels;
+static uint8_t  tile[AREA * AREA * 2];
+
+/* Constants -----------------------------------------------------------------*/
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Monotonic Time in Nanoseconds.
+*/
+/**************************************************************************/
+static uint64_t now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    Simulated Bus,each pixel costs bus_ns.
+*/
+/**************************************************************************/
+static void bus(uint32_t pixels)
+{
+	uint64_t end;
+
+	bus_pixels += pixels;
+	if (!bus_ns) return;
+	end = now_ns() + (uint64_t)pixels * bus_ns;
+	while (now_ns() < end);
+}
+
+static void b_rect(uint32_t x, uint32_t width, uint32_t y, uint32_t height)
+{
+	(void)x; (void)width; (void)y; (void)height;
+	bus(6);									/* command and address bytes */
+}
+
+static void b_wr_gram(uint16_t gram)
+{
+	(void)gram;
+	bus(1);
+}
+
+static void b_wr_block(uint8_t* p, unsigned int cnt)
+{
+	(void)p;
+	bus(cnt / 2);
+}
+
+/**************************************************************************/
+/*!
+    Clock Thread,ticktime in microseconds.
+	Sleeps between updates so it does not starve a single core host.
+*/
+/**************************************************************************/
+static void* clock_task(void* arg)
+{
+	struct timespec d = { 0, 20000 };
+
+	(void)arg;
+	while (running) {
+		ticktime = (uint32_t)(now_ns() / 1000);
+		nanosleep(&d, NULL);
+	}
+	return NULL;
+}
+
+/**************************************************************************/
+/*!
+    Producer Thread,fills and blits in its own column.
+*/
+/**************************************************************************/
+static void* producer_task(void* arg)
+{
+	uint8_t  id = (uint8_t)(uintptr_t)arg;
+	uint16_t x	= (uint16_t)(id * AREA);
+	uint16_t y;
+	uint32_t i;
+
+	for (i = 0; i < requests; i++) {
+		y = (uint16_t)((i % 8) * AREA);
+		if (i & 1) {
+			while (DispSrv_blit(id, x, x + AREA - 1, y, y + AREA - 1, tile, sizeof(tile)) != DSRV_OK) sched_yield();
+		}
+		else {
+			while (DispSrv_fill(id, x, x + AREA - 1, y, y + AREA - 1, (uint16_t)i) != DSRV_OK) sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispOps_t ops = { b_rect, b_wr_gram, b_wr_block, NULL, NULL, NULL, NULL, NULL };
+	uint32_t  np  = (argc > 1) ? (uint32_t)atoi(argv[1]) : DSRV_MAX_PRODUCERS;
+	pthread_t clk,th[DSRV_MAX_PRODUCERS];
+	uint64_t  t,total = 0;
+	uint32_t  i,n;
+	int		  busy;
+
+	requests = (argc > 2) ? (uint32_t)atoi(argv[2]) : 50000;
+	bus_ns	 = (argc > 3) ? (uint32_t)atoi(argv[3]) : 0;
+	if (!np || (np > DSRV_MAX_PRODUCERS)) np = DSRV_MAX_PRODUCERS;
+
+	DispSrv_init(&ops);
+	pthread_create(&clk, NULL, clock_task, NULL);
+	while (!ticktime);
+
+	t = now_ns();
+	for (i = 0; i < np; i++) pthread_create(&th[i], NULL, producer_task, (void*)(uintptr_t)i);
+
+	/* owner task */
+	do {
+		n = DispSrv_run();
+		if (!n) sched_yield();
+		total += n;
+		for (busy = 0, i = 0; i < np; i++) busy |= !DispSrv_idle((uint8_t)i) || (DispSrv.stat[i].posted < requests);
+	} while (busy);
+	t = now_ns() - t;
+
+	for (i = 0; i < np; i++) pthread_join(th[i], NULL);
+	running = 0;
+	pthread_join(clk, NULL);
+
+	printf("%u producers x %u requests,ring %u,bus %u ns/pixel\n", np, requests, DSRV_RING_SIZE, bus_ns);
+	printf("%.0f requests/s,%.2f us/request,%llu bus pixels\n",
+		   total * 1e9 / (double)t, (double)t / 1000.0 / (double)total, (unsigned long long)bus_pixels);
+	printf("coalesced %u,submits %u\n", DispSrv.coalesced, DispSrv.submits);
+	printf("%-9s %10s %10s %12s %12s\n", "producer", "posted", "rejected", "lat avg(us)", "lat max(us)");
+	for (i = 0; i < np; i++) {
+		DispSrv_Stat_t* s = &DispSrv.stat[i];
+		printf("%-9u %10u %10u %12.1f %12u\n", i, s->posted, s->rejected,
+			   s->done ? (double)s->lat_sum / s->done : 0.0, s->lat_max);
+	}
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,238 @@
+/********************************************************************************/
+/*!
+	@file			dapk.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Asset Pack Builder(host tool) for display_asset.c.		@n
+					usage: dapk out.bin|out.c name:fmt:width:height:file ...	@n
+					fmt = raw,rgb565,rgb565le,index8,index4,rle565,rle565le	@n
+					index8/index4 file = palette(RGB565 MSB first) + pixels.	@n
+					rle565 file = RGB565 pixels,encoded by the tool.			@n
+					build: cc -I.. dapk.c ../display_rle.c -o dapk
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added rle565 format.
+		2026.10.19	V3.00	Fail on duplicate name hash.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "display_rle.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define DAPK_MAGIC			0x4B504144
+#define DAPK_VERSION		1
+#define DAPK_ALIGN			32
+#define HEADER_SIZE			16
+#define ENTRY_SIZE			20
+#define MAX_ENTRIES			1024
+#define ALIGN_UP(v)			(((v) + DAPK_ALIGN - 1) & ~(uint32_t)(DAPK_ALIGN - 1))
+
+/* Variables -----------------------------------------------------------------*/
+static struct {
+	const char*	name;
+	size_t		namelen;
+	uint32_t	hash, offset, size;
+	uint16_t	width, height;
+	uint8_t		format;
+	uint8_t*	data;
+} ent[MAX_ENTRIES];
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const fmtname[] = { "raw", "rgb565", "index8", "index4", "rle565" };
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Little Endian Store.
+*/
+/**************************************************************************/
+static void put16(uint8_t* p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+
+/**************************************************************************/
+/*!
+    Name Hash(FNV-1a),same as DispAsset_hash().
+*/
+/**************************************************************************/
+static uint32_t hash(const char* s, size_t n)
+{
+	uint32_t h = 2166136261u;
+
+	while (n--) {
+		h ^= (uint8_t)*s++;
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+/**************************************************************************/
+/*!
+    Load Whole File.
+*/
+/**************************************************************************/
+static uint8_t* load(const char* path, uint32_t* size)
+{
+	FILE* fp = fopen(path, "rb");
+	uint8_t* p;
+	long n;
+
+	if (!fp) return NULL;
+	fseek(fp, 0, SEEK_END);
+	n = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	p = malloc(n ? n : 1);
+	if (p && (fread(p, 1, n, fp) != (size_t)n)) { free(p); p = NULL; }
+	fclose(fp);
+	*size = (uint32_t)n;
+
+	return p;
+}
+
+/**************************************************************************/
+/*!
+    Parse name:fmt:width:height:file.
+*/
+/**************************************************************************/
+static int parse(const char* arg, int i)
+{
+	char fmt[16], path[1024];
+	const char* c = strchr(arg, ':');
+	unsigned w,h;
+	uint32_t k,need;
+
+	if (!c || (sscanf(c + 1, "%15[^:]:%u:%u:%1023s", fmt, &w, &h, path) != 4)) {
+		fprintf(stderr, "bad entry: %s\n", arg);
+		return -1;
+	}
+	ent[i].name	   = arg;
+	ent[i].namelen = (size_t)(c - arg);
+	ent[i].hash	   = hash(arg, ent[i].namelen);
+	for (k = 0; k < (uint32_t)i; k++) {
+		/* lookup is by hash only,so same name and hash collision are both fatal */
+		if (ent[k].hash == ent[i].hash) {
+			fprintf(stderr, "name hash %08X of %.*s is also %.*s\n", ent[i].hash,
+					(int)ent[i].namelen, ent[i].name, (int)ent[k].namelen, ent[k].name);
+			return -1;
+		}
+	}
+	ent[i].width  = (uint16_t)w;
+	ent[i].height = (uint16_t)h;
+	ent[i].data   = load(path, &ent[i].size);
+	if (!ent[i].data) {
+		fprintf(stderr, "cannot read: %s\n", path);
+		return -1;
+	}
+
+	if (!strcmp(fmt, "rgb565le") || !strcmp(fmt, "rle565le")) {
+		/* swap to bus byte order */
+		for (k = 0; k + 1 < ent[i].size; k += 2) {
+			uint8_t t = ent[i].data[k]; ent[i].data[k] = ent[i].data[k+1]; ent[i].data[k+1] = t;
+		}
+		fmt[strlen(fmt) - 2] = '\0';			/* drop "le" */
+	}
+	for (k = 0; k < sizeof(fmtname) / sizeof(fmtname[0]); k++) {
+		if (!strcmp(fmt, fmtname[k])) break;
+	}
+	if (k == sizeof(fmtname) / sizeof(fmtname[0])) {
+		fprintf(stderr, "bad format: %s\n", fmt);
+		return -1;
+	}
+	ent[i].format = (uint8_t)k;
+
+	/* size check for image formats */
+	need = 0;
+	if (k == 1) need = w * h * 2;
+	if (k == 2) need = 256*2 + w * h;
+	if (k == 3) need = 16*2 + (w + 1) / 2 * h;
+	if (k == 4) need = w * h * 2;
+	if (need && (ent[i].size < need)) {
+		fprintf(stderr, "%s: %u bytes,need %u\n", path, ent[i].size, need);
+		return -1;
+	}
+
+	if (k == 4) {
+		uint8_t* rle = malloc(need + 2 * (need / 2 / DRLE_MAX_COUNT + 1));
+		if (!rle) return -1;
+		ent[i].size = DispRLE_encode(rle, ent[i].data, w * h);
+		free(ent[i].data);
+		ent[i].data = rle;
+	}
+
+	return 0;
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	uint32_t n = (uint32_t)argc - 2;
+	uint32_t i,pos,total;
+	uint8_t* out;
+	size_t   len;
+	FILE*    fp;
+
+	if ((argc < 3) || (n > MAX_ENTRIES)) {
+		fprintf(stderr, "usage: dapk out.bin|out.c name:fmt:width:height:file ...\n");
+		return 1;
+	}
+
+	pos = ALIGN_UP(HEADER_SIZE + n * ENTRY_SIZE);
+	for (i = 0; i < n; i++) {
+		if (parse(argv[i + 2], (int)i)) return 1;
+		ent[i].offset = pos;
+		pos = ALIGN_UP(pos + ent[i].size);
+	}
+	total = pos;
+
+	out = calloc(1, total);
+	if (!out) return 1;
+	put32(out + 0,  DAPK_MAGIC);
+	put16(out + 4,  DAPK_VERSION);
+	put16(out + 6,  n);
+	put32(out + 8,  total);
+	for (i = 0; i < n; i++) {
+		uint8_t* e = out + HEADER_SIZE + i * ENTRY_SIZE;
+		put32(e + 0,  ent[i].hash);
+		put32(e + 4,  ent[i].offset);
+		put32(e + 8,  ent[i].size);
+		put16(e + 12, ent[i].width);
+		put16(e + 14, ent[i].height);
+		e[16] = ent[i].format;
+		memcpy(out + ent[i].offset, ent[i].data, ent[i].size);
+	}
+
+	fp = fopen(argv[1], "wb");
+	if (!fp) return 1;
+	len = strlen(argv[1]);
+	if ((len > 2) && !strcmp(argv[1] + len - 2, ".c")) {
+		/* C array for linking into XIP flash */
+		fprintf(fp, "#include <inttypes.h>\n\n__attribute__((aligned(%d)))\nconst uint8_t dapk_pack[%u] = {", DAPK_ALIGN, total);
+		for (i = 0; i < total; i++) fprintf(fp, "%s0x%02X,", (i % 16) ? "" : "\n\t", out[i]);
+		fprintf(fp, "\n};\n");
+	}
+	else {
+		fwrite(out, 1, total, fp);
+	}
+	fclose(fp);
+
+	printf("%u entries,%u bytes\n", n, total);
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
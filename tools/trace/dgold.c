@@ -0,0 +1,208 @@
+/********************************************************************************/
+/*!
+	@file			dgold.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        2.00
+    @date           2026.10.19
+	@brief          Golden Bus Trace Recorder/Checker(host tool).				@n
+					usage: dgold record|check file.trc [id ...]				@n
+					id = device ID read values served in order.				@n
+					build: cc -I. -I../.. -DUSE_ILI932x_TFT -DGPIO_ACCESS_16BIT	@n
+					 -DDGOLD_DRIVER_H=\"ili932x.h\" dgold.c ../../ili932x.c	@n
+					 ../../display_trace.c -o dgold							@n
+					golden.sh runs the whole matrix in golden/.
+					Init,clear,window/pixel/block writes and optional
+					rotation,frame rate and sleep/wake are recorded.
+					With -DDGOLD_CHUNK=bytes a block over 2 chunks is
+					added and every CS low data run is checked to hold
+					at most one chunk,each resumed by 3Ch.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added chunked block write check(DGOLD_CHUNK).
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include DGOLD_DRIVER_H
+
+/* Defines -------------------------------------------------------------------*/
+#define TRACE_SIZE			(8u << 20)
+#define MAX_IDS				32
+
+/* Variables -----------------------------------------------------------------*/
+volatile uint32_t ticktime;
+static uint16_t ids[MAX_IDS];
+static uint8_t  buf[TRACE_SIZE];
+static uint8_t  gold[TRACE_SIZE];
+#ifdef DGOLD_CHUNK
+static uint8_t  big[DGOLD_CHUNK * 2 + 1808];
+#endif
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const tname[] = { "cmd", "dat", "delay", "pin", "rd", "repeat" };
+
+/* Functions -----------------------------------------------------------------*/
+
+#ifdef DGOLD_CHUNK
+/**************************************************************************/
+/*!
+    Bus Arbitration Hook,nothing else on the bus.
+*/
+/**************************************************************************/
+static void bus_yield(void)
+{
+}
+
+/**************************************************************************/
+/*!
+    Check Chunked Block Writes.
+	A CS low run holds at most DGOLD_CHUNK data bytes,and the run after
+	a full chunk MUST start with Write Memory Continue(3Ch).
+	Returns number of chunk splits,-1 on violation.
+*/
+/**************************************************************************/
+static int32_t chunk_check(const uint8_t* trace, uint32_t len)
+{
+	DispTrace_Rd_t rd;
+	DispTrace_Ev_t ev;
+	uint32_t n = 0,at = 0;
+	int32_t  splits = 0;
+	uint8_t  low = 0,first = 0,full = 0;
+
+	DispTrace_open(&rd, trace, len);
+	for (; DispTrace_next(&rd, &ev); at++) {
+		if ((ev.type == DTRACE_PIN) && ((ev.val >> 1) == DTRACE_PIN_CS)) {
+			if (!(ev.val & 1))	{ low = 1; first = 1; n = 0; }
+			else if (low)		{ low = 0; full = (n == DGOLD_CHUNK); }
+			continue;
+		}
+		if (!low || ((ev.type != DTRACE_CMD) && (ev.type != DTRACE_DAT))) continue;
+
+		if (first && full) {
+			if ((ev.type != DTRACE_CMD) || (ev.val != 0x3C)) {
+				printf("event %u: chunk not resumed by 3Ch\n", at);
+				return -1;
+			}
+			splits++;
+		}
+		first = 0;
+		if ((ev.type == DTRACE_DAT) && (++n > DGOLD_CHUNK)) {
+			printf("event %u: CS low run over %u bytes\n", at, DGOLD_CHUNK);
+			return -1;
+		}
+	}
+
+	return splits;
+}
+#endif
+
+/**************************************************************************/
+/*!
+    Fixed Workload,every step goes through the driver entry points.
+*/
+/**************************************************************************/
+static void workload(void)
+{
+	uint8_t  blk[8 * 8 * 2];
+	uint32_t i;
+
+	Display_init_if();
+	Display_clear_if();
+
+	for (i = 0; i < sizeof(blk); i++) blk[i] = (uint8_t)(i * 37);
+	Display_rect_if(8, 15, 16, 23);
+	Display_wr_block_if(blk, sizeof(blk));
+
+	Display_rect_if(MAX_X - 4, MAX_X - 1, MAX_Y - 1, MAX_Y - 1);
+	for (i = 0; i < 4; i++) Display_wr_dat_if((uint16_t)(0xF800 >> (i * 4)));
+
+#ifdef Display_set_rotation_if
+	Display_set_rotation_if(90);
+	Display_rect_if(0, 3, 0, 0);
+	for (i = 0; i < 4; i++) Display_wr_dat_if(0x07E0);
+	Display_set_rotation_if(0);
+#endif
+#ifdef Display_set_frame_rate_if
+	for (i = 0; i < Display_frame_rates_if; i++) Display_set_frame_rate_if((uint8_t)i);
+#endif
+#ifdef Display_wake_if
+	Display_sleep_if();
+	Display_wake_if();
+#endif
+#ifdef DGOLD_CHUNK
+	for (i = 0; i < sizeof(big); i++) big[i] = (uint8_t)(i * 13);
+	Display_set_bus_yield_if(bus_yield);
+	Display_rect_if(0, 99, 0, sizeof(big) / 200 - 1);
+	Display_wr_block_if(big, sizeof(big));
+#endif
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispTrace_Ev_t ea,eb;
+	uint32_t n,len,glen;
+	int32_t  at;
+	FILE*	 f;
+
+	if ((argc < 3) || (strcmp(argv[1], "record") && strcmp(argv[1], "check"))) {
+		fprintf(stderr, "usage: dgold record|check file.trc [id ...]\n");
+		return 2;
+	}
+	for (n = 0; (n + 3 < (uint32_t)argc) && (n < MAX_IDS); n++) ids[n] = (uint16_t)strtoul(argv[n + 3], NULL, 0);
+
+	DispTrace_set_read(ids, n);
+	DispTrace_begin(buf, TRACE_SIZE);
+	workload();
+	len = DispTrace_end();
+	if (!len) {
+		fprintf(stderr, "trace buffer is short\n");
+		return 2;
+	}
+#ifdef DGOLD_CHUNK
+	if ((at = chunk_check(buf, len)) < 2) {
+		printf("%s: chunk check failed(%d splits)\n", argv[2], at);
+		return 1;
+	}
+#endif
+
+	if (!strcmp(argv[1], "record")) {
+		if (!(f = fopen(argv[2], "wb")) || (fwrite(buf, 1, len, f) != len)) {
+			fprintf(stderr, "%s: write error\n", argv[2]);
+			return 2;
+		}
+		fclose(f);
+		printf("%s: %u bytes\n", argv[2], len);
+		return 0;
+	}
+
+	if (!(f = fopen(argv[2], "rb"))) {
+		fprintf(stderr, "%s: no golden trace\n", argv[2]);
+		return 2;
+	}
+	glen = (uint32_t)fread(gold, 1, TRACE_SIZE, f);
+	fclose(f);
+
+	at = DispTrace_diff(gold, glen, buf, len, &ea, &eb);
+	if (at < 0) {
+		printf("%s: ok\n", argv[2]);
+		return 0;
+	}
+
+	printf("%s: differs at event %d,golden %s %04X,now %s %04X\n", argv[2], at,
+		   (ea.type < 6) ? tname[ea.type] : "end", ea.val, (eb.type < 6) ? tname[eb.type] : "end", eb.val);
+	return 1;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
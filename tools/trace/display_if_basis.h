@@ -0,0 +1,86 @@
+/********************************************************************************/
+/*!
+	@file			display_if_basis.h
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        1.00
+    @date           2026.10.19
+	@brief          Host Bus Stand-In for Trace Recording(display_trace.c).	@n
+					Put this directory before the MCU port on include path,	@n
+					e.g. cc -Itools/trace -I. -DUSE_ILI934x_SPI_TFT ili934x.c	@n
+					display_trace.c test.c,host program defines ticktime.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+#ifndef DISPLAY_IF_BASIS_H
+#define DISPLAY_IF_BASIS_H 0x0100
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* basic includes */
+#include <string.h>
+#include <inttypes.h>
+
+/* display includes */
+#include "display_trace.h"
+
+/* Parallel bus is GPIO with WR strobe,data captured at WR L->H edge */
+#if !defined(GPIO_ACCESS_8BIT) && !defined(GPIO_ACCESS_16BIT)
+ #define GPIO_ACCESS_16BIT
+#endif
+#define DISPLAY_DATAPORT		DispTrace_port
+#define DISPLAY_CMDPORT			DispTrace_port
+#define ReadLCDData(x)			((x) = DispTrace_read())
+
+/* Control Pins */
+#define DISPLAY_RES_SET()		DispTrace_pin(DTRACE_PIN_RES, 1)
+#define DISPLAY_RES_CLR()		DispTrace_pin(DTRACE_PIN_RES, 0)
+#define DISPLAY_CS_SET()		DispTrace_pin(DTRACE_PIN_CS,  1)
+#define DISPLAY_CS_CLR()		DispTrace_pin(DTRACE_PIN_CS,  0)
+#define DISPLAY_DC_SET()		DispTrace_pin(DTRACE_PIN_DC,  1)
+#define DISPLAY_DC_CLR()		DispTrace_pin(DTRACE_PIN_DC,  0)
+#define DISPLAY_WR_SET()		DispTrace_wr(1)
+#define DISPLAY_WR_CLR()		DispTrace_wr(0)
+#define DISPLAY_RD_SET()		((void)0)
+#define DISPLAY_RD_CLR()		((void)0)
+#define DISPLAY_SCK_SET()		DispTrace_pin(DTRACE_PIN_SCK, 1)
+#define DISPLAY_SCK_CLR()		DispTrace_pin(DTRACE_PIN_SCK, 0)
+#define DISPLAY_SDI_SET()		DispTrace_pin(DTRACE_PIN_SDI, 1)
+#define DISPLAY_SDI_CLR()		DispTrace_pin(DTRACE_PIN_SDI, 0)
+#define DISPLAY_SDO_SET()		((void)0)
+#define DISPLAY_SDO_CLR()		((void)0)
+#define DISPLAY_ASSART_CS()		DispTrace_pin(DTRACE_PIN_CS,  0)
+#define DISPLAY_NEGATE_CS()		DispTrace_pin(DTRACE_PIN_CS,  1)
+
+/* Serial Bus */
+#define SendSPI(d)				DispTrace_spi((uint8_t)(d))
+#define SendSPI16(d)			do { DispTrace_spi((uint8_t)((d) >> 8)); DispTrace_spi((uint8_t)(d)); } while (0)
+#define RecvSPI()				((uint8_t)DispTrace_read())
+#define DMA_TRANSACTION(p,n)	do { uint32_t _i; for (_i = 0; _i < (uint32_t)(n); _i++) DispTrace_spi(((const uint8_t*)(p))[_i]); } while (0)
+#define TFT_SDA_READ			0
+#define TFT_SDA_WRITE			1
+#define Display_ChangeSDA_If(d)	((void)0)
+
+/* Colours used by drivers(RGB565) */
+#ifndef COL_BLACK
+ #define COL_BLACK				0x0000
+ #define COL_RED				0xF800
+ #define COL_BLUE				0x001F
+ #define COL_WHITE				0xFFFF
+#endif
+
+/* Board */
+#define _delay_ms(ms)			DispTrace_delay(ms)
+#define Display_IoInit_If()		((void)0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_IF_BASIS_H */
@@ -0,0 +1,127 @@
+/********************************************************************************/
+/*!
+	@file			dpred.c
+	@author         Nemui Trinomius (http://nemuisan.blog.bai.ne.jp)
+    @version        3.00
+    @date           2026.10.19
+	@brief          Frame-Rate Predictor(host tool) for one driver and bus.	@n
+					usage: dpred profile id ...,id = device ID read values	@n
+					profile = fsmc:hclk:addset:datast,spi:hz:txn_ns:dma_ns,	@n
+					          gpio:write_ns:pin_ns(dma_ns 0 = no DMA)		@n
+					build: cc -I. -I../.. -DUSE_ILI934x_SPI_TFT				@n
+					 -DDPRED_DRIVER_H=\"ili934x.h\" dpred.c ../../ili934x.c	@n
+					 ../../display_trace.c ../../display_predict.c -o dpred	@n
+					index-register controllers add -DDPRED_STYLE=DTRACE_REG.	@n
+					Wake latency is compared with cold init if supported.	@n
+					IDs are required,unknown IDs loop in the driver:		@n
+					 ili934x SPI      0 0 0x93 0x41(D3h,ILI9341)			@n
+					 ili9481 GPIO16   0 0 0 0x94 0x81(BFh,ILI9481)			@n
+					 ili932x GPIO16   0x9325(R00h,ILI9325)					@n
+					other buses/controllers as in golden.sh.
+
+    @section HISTORY
+		2026.10.19	V1.00	First Release.
+		2026.10.19	V2.00	Added wake latency against cold init.
+		2026.10.19	V3.00	Refuse to run without device IDs.
+
+    @section LICENSE
+		BSD License. See Copyright.txt
+*/
+/********************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include DPRED_DRIVER_H
+#include "display_predict.h"
+
+/* Defines -------------------------------------------------------------------*/
+#ifndef DPRED_STYLE
+ #define DPRED_STYLE		DTRACE_DCS
+#endif
+#define FRAMES				8
+#define TRACE_SIZE			(8u << 20)
+#define MAX_IDS				16
+
+/* Variables -----------------------------------------------------------------*/
+volatile uint32_t ticktime;
+static uint16_t ids[MAX_IDS];
+static uint8_t  buf[TRACE_SIZE];
+
+/* Constants -----------------------------------------------------------------*/
+static const char* const wname[DPRED_WORKLOADS] = { "full frame", "dirty UI", "text scroll" };
+
+/* Functions -----------------------------------------------------------------*/
+
+/**************************************************************************/
+/*!
+    Parse fsmc:hclk:addset:datast / spi:hz:txn_ns:dma_ns / gpio:write_ns:pin_ns.
+*/
+/**************************************************************************/
+static int profile(DispPredict_Profile_t* p, const char* arg)
+{
+	unsigned a,b,c;
+
+	if (sscanf(arg, "fsmc:%u:%u:%u", &a, &b, &c) == 3) { DispPredict_fsmc(p, a, b, c); return 0; }
+	if (sscanf(arg, "spi:%u:%u:%u",  &a, &b, &c) == 3) { DispPredict_spi(p, a, b, c);  return 0; }
+	if (sscanf(arg, "gpio:%u:%u",	 &a, &b)	 == 2) { DispPredict_gpio(p, a, b);	   return 0; }
+
+	return -1;
+}
+
+/**************************************************************************/
+/*!
+    Main.
+*/
+/**************************************************************************/
+int main(int argc, char* argv[])
+{
+	DispOps_t ops = DISPOPS_DRIVER;
+	DispPredict_Profile_t prof;
+	DispPredict_Result_t  r;
+	uint32_t n,w,len;
+	uint64_t cold;
+
+	if ((argc < 3) || profile(&prof, argv[1])) {
+		fprintf(stderr, "usage: dpred fsmc:hclk:addset:datast|spi:hz:txn_ns:dma_ns|gpio:write_ns:pin_ns id ...\n"
+						"       id = device ID read values,e.g. 0 0 0x93 0x41 for ili934x SPI\n");
+		return 1;
+	}
+	for (n = 0; (n + 2 < (uint32_t)argc) && (n < MAX_IDS); n++) ids[n] = (uint16_t)strtoul(argv[n + 2], NULL, 0);
+#ifdef Display_scroll_if
+	ops.scroll = Display_scroll_if;
+#endif
+
+	/* init once,then only workload frames are recorded */
+	DispTrace_set_read(ids, n);
+	DispTrace_begin(buf, TRACE_SIZE);
+	Display_init_if();
+	len = DispTrace_end();
+	DispPredict_cost(&prof, DPRED_STYLE, buf, len, 1, &r);
+	cold = r.frame_ns;
+	printf("%s,init trace %u bytes\n", prof.name, len);
+	printf("cold init  %10.1f us\n", cold / 1000.0);
+
+#ifdef Display_wake_if
+	/* sleep is not timed,wake-to-visible only */
+	Display_sleep_if();
+	DispTrace_begin(buf, TRACE_SIZE);
+	Display_wake_if();
+	len = DispTrace_end();
+	DispPredict_cost(&prof, DPRED_STYLE, buf, len, 1, &r);
+	printf("wake       %10.1f us(%.1f%% of cold init)\n", r.frame_ns / 1000.0, cold ? 100.0 * r.frame_ns / cold : 0.0);
+#endif
+	printf("\n");
+
+	printf("%-12s %10s %10s %10s %10s %8s\n", "workload", "cmd us", "pixel us", "idle us", "frame us", "fps");
+	for (w = 0; w < DPRED_WORKLOADS; w++) {
+		if (DispPredict_run(&prof, DPRED_STYLE, (uint8_t)w, FRAMES, MAX_X, MAX_Y, &ops, buf, TRACE_SIZE, &r)) return 1;
+		printf("%-12s %10.1f %10.1f %10.1f %10.1f %8.2f\n", wname[w],
+			   r.cmd_ns / 1000.0, r.pixel_ns / 1000.0, r.idle_ns / 1000.0, r.frame_ns / 1000.0, r.fps_x100 / 100.0);
+	}
+
+	return 0;
+}
+
+
+/* End Of File ---------------------------------------------------------------*/
@@ -0,0 +1,75 @@
+#!/bin/sh
+# Golden bus trace matrix for ili932x,ili9481 and chunked ili934x(host).
+# usage: tools/trace/golden.sh [record]
+#   check(default) : rebuild dgold per driver/bus,compare with golden/*.trc
+#   record         : rewrite golden/*.trc after an intended driver change
+# Each case serves device ID reads so that one controller branch is taken.
+# Built with -Wall -Wextra -Werror,driver #warning notes stay warnings.
+
+cd "$(dirname "$0")" || exit 2
+CC=${CC:-cc}
+MODE=${1:-check}
+TMP=$(mktemp -d) || exit 2
+trap 'rm -rf "$TMP"' EXIT
+T=""
+command -v timeout >/dev/null 2>&1 && T="timeout 10"
+cases=0
+fails=0
+
+build() {
+	name=$1; drv=$2; shift 2
+	$CC -O1 -Wall -Wextra -Werror -I. -I../.. "$@" -DDGOLD_DRIVER_H="\"$drv.h\"" \
+		dgold.c "../../$drv.c" ../../display_trace.c -o "$TMP/$name" || exit 2
+}
+
+run() {
+	name=$1; tag=$2; shift 2
+	cases=$((cases + 1))
+	$T "$TMP/$name" "$MODE" "golden/${name}_$tag.trc" "$@" || { fails=$((fails + 1)); echo "FAIL ${name}_$tag"; }
+}
+
+mkdir -p golden
+
+# ILI932x:index register controllers,ID at R00h
+build ili932x_gpio16 ili932x -DUSE_ILI932x_TFT -DGPIO_ACCESS_16BIT
+build ili932x_gpio8  ili932x -DUSE_ILI932x_TFT -DGPIO_ACCESS_8BIT
+build ili932x_spi3   ili932x -DUSE_ILI932x_SPI_TFT
+build ili932x_spi4   ili932x -DUSE_ILI932x_SPI_TFT -DILI9325_SPI_4WIREMODE -Wno-error=cpp
+for id in 9325 5408 6809 6807 9320 1505 0505 4531 3145 9328 7783 B505 C505 4535 9331 1580 0001 9335; do
+	hi=$((0x$id >> 8)); lo=$((0x$id & 0xFF))
+	run ili932x_gpio16 "$id" "0x$id"
+	run ili932x_gpio8  "$id" "$hi" "$lo"
+	run ili932x_spi3   "$id" 0 "$hi" "$lo"
+	run ili932x_spi4   "$id" "$hi" "$lo"
+done
+
+# ILI9481 family:BFh,then D3h(ILI9486/88) and D0h(HX8357C/D) probes
+build ili9481_gpio16 ili9481 -DUSE_ILI9481_TFT -DGPIO_ACCESS_16BIT
+build ili9481_gpio8  ili9481 -DUSE_ILI9481_TFT -DGPIO_ACCESS_8BIT
+build ili9481_spi    ili9481 -DUSE_ILI9481_SPI_TFT -DUSE_SOFTWARE_SPI
+for bus in gpio16 gpio8; do
+	run ili9481_$bus 9481 0 0 0 0x94 0x81
+	run ili9481_$bus 8357 0 0 0 0x83 0x57
+	run ili9481_$bus 1581 0 0 0 0x15 0x81
+	run ili9481_$bus 6804 0 0 0 0x68 0x04
+	run ili9481_$bus 9486 0 0 0 0 0  0 0 0x94 0x86
+	run ili9481_$bus 9488 0 0 0 0 0  0 0 0x94 0x88
+	run ili9481_$bus hx90 0 0 0 0 0  0 0 0 0  0 0x90
+	run ili9481_$bus hx99 0 0 0 0 0  0 0 0 0  0 0x99
+done
+# serial BFh is 24bit shifted by 7,R61581 is probed by BFh again
+run ili9481_spi 9481 0 0 0x4A 0x40 0x80
+run ili9481_spi 8357 0 0 0x41 0xAB 0x80
+run ili9481_spi 6804 0 0 0x34 0x02 0x00
+run ili9481_spi 1581 0 0 0 0 0  0 0 0 0x15 0x81
+run ili9481_spi 9486 0 0 0 0 0  0 0 0 0 0  0 0 0x94 0x86
+run ili9481_spi 9488 0 0 0 0 0  0 0 0 0 0  0 0 0x94 0x88
+run ili9481_spi hx90 0 0 0 0 0  0 0 0 0 0  0 0 0 0  0x90
+run ili9481_spi hx99 0 0 0 0 0  0 0 0 0 0  0 0 0 0  0x99
+
+# ILI934x SPI with chunked block write,also checks CS runs and 3Ch resume
+build ili934x_chunk ili934x -DUSE_ILI934x_SPI_TFT -DILI934x_BLOCK_CHUNK=4096 -DDGOLD_CHUNK=ILI934x_BLOCK_CHUNK
+run ili934x_chunk 9341 0 0 0x93 0x41
+
+echo "$cases cases,$fails failed"
+[ "$fails" -eq 0 ]